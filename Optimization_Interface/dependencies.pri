@@ -0,0 +1,36 @@
+# Libraries and headers for skyenet solver and mikipilot packets
+
+#MIKIPILOT = $$PWD/../../../mikipilot
+
+
+INCLUDEPATH += $$PWD/../../skyenet/algorithm/
+INCLUDEPATH += $$PWD/../../skyenet/cprs/headers/
+INCLUDEPATH += $$PWD/../../skyenet/csocp/
+INCLUDEPATH += $$PWD/../../mikipilot
+INCLUDEPATH += $$PWD/../../mikipilot/build/gcs/executable/
+
+
+# //SKYENET//
+# qmake CONFIG+=reference_solver builds without skyenet libraries and
+# solves with the built in reference solver, headers are still needed
+reference_solver {
+    DEFINES += OPTGUI_REFERENCE_SOLVER
+} else {
+    LIBS += -L$$PWD/../../skyenet/algorithm -lalgorithm # looks for libalgorithm.a file
+    LIBS += -L$$PWD/../../skyenet/cprs/build -lCPRS     # looks for libCPRS.a
+    LIBS += -L$$PWD/../../skyenet/csocp -lCSOCP         # looks for libCSOCP.a
+
+    SOURCES += $$PWD/src/controls/skyefly_solver.cpp
+    HEADERS += $$PWD/include/controls/skyefly_solver.h
+}
+
+# //MIKIPILOT//
+LIBS += -L$$PWD/../../mikipilot/build/gcs/executable/ -l_autogen_globals     # looks for lib_autogen_globals.a
+LIBS += -L$$PWD/../../mikipilot/build/gcs/executable/ -l_autogen_packet      # looks for lib_autogen_packet.a
+LIBS += -L$$PWD/../../mikipilot/build/gcs/executable/ -l_autogen_state       # looks for lib_autogen_state.a
+LIBS += -L$$PWD/../../mikipilot/build/gcs/executable/ -l_autogen_parameter   # looks for lib_autogen_parameter.a
+LIBS += -L$$PWD/../../mikipilot/build/gcs/executable/ -l_autogen_timestamped # looks for lib_autogen_timestamped.a
+LIBS += -L$$PWD/../../mikipilot/build/gcs/executable/ -l_autogen_bus         # looks for lib_autogen_bus.a
+LIBS += -L$$PWD/../../mikipilot/build/gcs/executable/ -l_network             # looks for lib_network.a
+LIBS += -L$$PWD/../../mikipilot/build/gcs/executable/ -l_utilities           # looks for lib_utilities.a
+LIBS += -L$$PWD/../../mikipilot/build/gcs/executable/ -l_gnc                 # looks for lib_gnc.a
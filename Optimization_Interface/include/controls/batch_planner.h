@@ -0,0 +1,51 @@
+// TITLE:   Optimization_Interface/include/controls/batch_planner.h
+// AUTHORS: Daniel Sullivan
+// LAB:     Autonomous Controls Lab (ACL)
+// LICENSE: Copyright 2020, All Rights Reserved
+
+// Plans config file scenarios without the GUI, one per pool thread
+
+#ifndef BATCH_PLANNER_H_
+#define BATCH_PLANNER_H_
+
+#include <QRunnable>
+#include <QString>
+#include <QStringList>
+
+namespace optgui {
+
+class BatchPlanner : public QRunnable {
+ public:
+    struct Options {
+        // directory for trajectory csv files
+        QString output_dir;
+        bool is_free_final_time;
+        // max solver passes per target
+        quint32 max_passes;
+    };
+
+    // scenario is a config file written by save dialog
+    BatchPlanner(QString const &config_file, Options const &options);
+
+    // solve drone to each final point in scenario and write
+    // one trajectory file per final point
+    void run() override;
+
+    // csv summary rows, one per final point, valid after run
+    QStringList getSummary();
+    // empty if scenario ran
+    QString getError();
+
+    // header for summary rows
+    static QString getSummaryHeader();
+
+ private:
+    QString config_file_;
+    Options options_;
+    QStringList summary_;
+    QString error_;
+};
+
+}  // namespace optgui
+
+#endif  // BATCH_PLANNER_H_
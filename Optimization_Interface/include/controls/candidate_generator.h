@@ -0,0 +1,115 @@
+// TITLE:   Optimization_Interface/include/controls/candidate_generator.h
+// AUTHORS: Daniel Sullivan
+// LAB:     Autonomous Controls Lab (ACL)
+// LICENSE: Copyright 2020, All Rights Reserved
+
+// Solves variants of one drone's problem in parallel to choose from
+
+#ifndef CANDIDATE_GENERATOR_H_
+#define CANDIDATE_GENERATOR_H_
+
+#include <QObject>
+#include <QThreadPool>
+#include <QVector>
+#include <QPointF>
+#include <QString>
+#include <QAtomicInt>
+
+#include <memory>
+
+#include "cprs.h"
+#include "algorithm.h"
+#include "autogen/lib.h"
+
+#include "include/models/constraint_model.h"
+
+namespace optgui {
+
+// solved variant and its ranking metrics
+struct Candidate {
+    // description of variant
+    QString label;
+    // GUI points and mikipilot packet, same as current traj
+    QVector<QPointF> points;
+    autogen::packet::traj2dof traj2dof;
+    // final time in seconds
+    qreal final_time;
+    // largest acceleration magnitude in m/s^2
+    qreal peak_accel;
+    bool is_feasible;
+};
+
+class CandidateGenerator : public QObject {
+    Q_OBJECT
+
+ public:
+    explicit CandidateGenerator(QObject *parent = nullptr);
+    // waits for running solves
+    ~CandidateGenerator();
+
+    // solve variants of snapshot problem from initial state in meters
+    // to final pos in meters. Returns false if still running
+    bool generate(DroneModelItem *drone,
+                  std::shared_ptr<ConstraintSnapshot const> snapshot,
+                  QVector3D const &r_i, QVector3D const &v_i,
+                  QVector3D const &a_i, QVector3D const &r_f);
+    bool isRunning();
+
+    // drone of last generated candidates
+    DroneModelItem *getDrone();
+    // ranked candidates, best first, only call after candidatesReady
+    QVector<Candidate> getCandidates();
+
+    // max variants solved per request
+    static const int MAX_CANDIDATES = 18;
+
+ signals:
+    // emitted in parent thread when all variants are solved
+    void candidatesReady();
+
+ private slots:
+    // rank results once last variant finishes
+    void finish();
+
+ private:
+    // one variant solved by a pool thread
+    struct Variant {
+        QString label;
+        skyenet::params P;
+        double wp[skyenet::MAX_WAYPOINTS][3];
+    };
+
+    class Task;
+
+    QThreadPool pool_;
+    // variants and results of current request, each slot written
+    // by one task
+    QVector<Variant> variants_;
+    QVector<Candidate> results_;
+    // taken once before tasks start, tasks never detach results
+    Candidate *results_data_;
+    QAtomicInt remaining_;
+    bool is_running_;
+    bool is_free_final_time_;
+    double r_i_[3];
+    double v_i_[3];
+    double a_i_[3];
+    double r_f_[3];
+    DroneModelItem *drone_;
+
+    // solve variant at index, run by pool thread
+    void solveVariant(int index);
+
+    // solver passes per variant, stops early once settled
+    static const quint32 MAX_PASSES = 10;
+    // final times are ranked in steps of this many seconds
+    static constexpr double FINAL_TIME_TOL = 0.001;
+
+    // ordering of candidates, feasible first then fastest
+    // then gentlest
+    static bool isBetter(Candidate const &a, Candidate const &b);
+};
+
+}  // namespace optgui
+
+#endif  // CANDIDATE_GENERATOR_H_
@@ -3,20 +3,17 @@
 // LAB:     Autonomous Controls Lab (ACL)
 // LICENSE: Copyright 2020, All Rights Reserved
 
-// Thread for concurrently running Skyfly compute
+// Pool thread for concurrently running Skyfly compute
 
 #ifndef COMPUTE_THREAD_H_
 #define COMPUTE_THREAD_H_
 
 #include <QThread>
-
-#include "cprs.h"
-#include "algorithm.h"
+#include <QMutex>
+#include <QAtomicInteger>
 
 #include "include/models/constraint_model.h"
-#include "include/graphics/path_graphics_item.h"
-#include "include/graphics/drone_graphics_item.h"
-#include "include/globals.h"
+#include "include/controls/solver_scheduler.h"
 
 namespace optgui {
 
@@ -25,52 +22,35 @@ class ComputeThread : public QThread {
 
  public:
     explicit ComputeThread(ConstraintModel *model,
-                           DroneGraphicsItem *drone,
-                           PathGraphicsItem *traj_graphic);
+                           SolverScheduler *scheduler);
     ~ComputeThread();
 
-    PathGraphicsItem *getTrajGraphic();
-    void setTarget(PointModelItem *target);
-    void reInit();
-    PointModelItem *getTarget();
     void stopCompute();
-    DroneGraphicsItem *getDroneGraphic();
+    // number of times thread woke up while idle
+    quint64 getIdleWakeups();
 
  protected:
     void run() override;
 
- // slots for signals from thread are run in parent thread
- signals:
-    void updateGraphics(PathGraphicsItem *traj_graphic,
-                        DroneGraphicsItem *drone_graphic);
-    void updateMessage(DroneModelItem *drone);
-    void finalTime(DroneModelItem *drone, double final_time);
-
  private:
     // GUI data
     ConstraintModel *model_;
-    // problem data
-    skyenet::SkyeFly fly_;
-
-    // vehicle and target
-    DroneGraphicsItem *drone_;
-    PointModelItem *target_;
-    PathGraphicsItem *traj_graphic_;
+    // source of drone contexts to solve
+    SolverScheduler *scheduler_;
 
     // compute traj flag
     bool run_loop_;
 
-    // lock for accessing resources shared by compute_thread and controller
-    // (target and run flag)
+    // lock for accessing run flag
     QMutex mutex_;
 
-    // flag to reset inputs
-    bool target_changed_;
-
-    INPUT_CODE validateInputs(QVector<QRegion> const &ellipse_regions,
-                              QVector3D const &initial_pos,
-                              QVector3D const &final_pos);
-    void setFeasibilityColor(bool is_feasible);
+    // max time to sleep while idle before rechecking
+    static const unsigned long IDLE_WAIT_MS = 1000;
+    // count of wakeups while idle
+    QAtomicInteger<quint64> idle_wakeups_;
+    // block until model, target or run flag changes, or until
+    // wait_usec passes if not negative
+    void waitForWork(quint64 seen, qint64 wait_usec);
 
     bool getRunFlag();
 };
@@ -15,16 +15,20 @@
 #include <QTableWidget>
 
 #include "include/graphics/canvas.h"
+#include "include/graphics/repaint_coalescer.h"
 #include "include/models/constraint_model.h"
 #include "include/window/port_dialog.h"
 #include "include/window/save_dialog.h"
 #include "include/window/load_dialog.h"
-#include "include/network/drone_socket.h"
-#include "include/network/ellipse_socket.h"
-#include "include/network/cylinder_socket.h"
-#include "include/network/waypoint_socket.h"
-#include "include/network/point_socket.h"
-#include "include/controls/compute_thread.h"
+#include "include/network/trajectory_uplink.h"
+#include "include/network/network_ingest.h"
+#include "include/network/session_recorder.h"
+#include "include/network/session_replay.h"
+#include "include/controls/solver_context.h"
+#include "include/controls/solver_scheduler.h"
+#include "include/controls/candidate_generator.h"
+#include "include/controls/flight_recorder.h"
+#include "include/controls/reference_clock.h"
 
 namespace optgui {
 
@@ -35,8 +39,8 @@ class Controller : public QObject {
     explicit Controller(Canvas *canvas);
     ~Controller();
 
-    // SkyFly compute thread
-    QMap<DroneModelItem *, ComputeThread *> compute_threads_;
+    // SkyFly problem for each drone, owned by scheduler
+    QMap<DroneModelItem *, SolverContext *> solver_contexts_;
 
     // add constraints
     void addEllipse(QPointF const &point, qreal radius = 120);
@@ -78,23 +82,56 @@ class Controller : public QObject {
     void setExecutedDrone(DroneModelItem *drone);
     void unstageTraj();
 
+    // solve variants for current drone and target in background,
+    // top ranked are shown when done
+    void generateCandidates();
+    // stage candidate traj for its drone
+    void selectCandidate(CandidateGraphicsItem *item);
+
     // toggle simulate traj
     void setSimulated(bool state);
     void setStageBool(bool state);
     void setTrajLock(bool state);
+    // replan executing trajectory from telemetry
+    void setMpcMode(bool state);
     void setFreeFinalTime(bool state);
     void setDataCapture(bool state);
 
+    // record telemetry and operator edits to a session file
+    bool setSessionRecording(bool state);
+    // record operator edit from view, not programmatic changes
+    void recordEdit(SessionEvent::EDIT_TYPE edit, double value = 0);
+    // play session recorded with current config through telemetry
+    // ingest, at recorded speed or as fast as possible
+    bool startReplay(QString const &filename, bool is_fast);
+    void stopReplay();
+    QString getReplayError();
+
     // pass info between model and view
     quint32 getNumWaypoints();
     void setClearance(qreal clearance);
+    // toggle scene index for hit tests and culling
+    void setSpatialIndex(bool is_indexed);
+    // replanning rate in Hz and deadline in ms for current drone,
+    // or all drones and new drones if none selected
+    void setReplanRate(qreal rate);
+    void setDeadline(qreal deadline);
+    // anytime solve budget in ms per pass for all drones, 0 is off
+    void setAnytimeBudget(qreal budget);
     void setCurrFinalPoint(PointModelItem *point);
     void setCurrDrone(DroneModelItem *drone);
     FEASIBILITY_CODE getIsValidTraj();
     INPUT_CODE getIsValidInput();
 
+    // repaint rates, then solve rate and latency percentiles per
+    // stage for each drone
+    QString getSolverStatsText();
+    // count a view repaint for stats
+    void recordPaint(QRegion const &region);
+    // write latency summary and histogram buckets to csv
+    bool dumpSolverStats(QString const &filename);
+
  signals:
-    void trajectoryExecuted(DroneModelItem *, autogen::packet::traj2dof data);
     // signal view to update
     void finalTime(qreal time);
     void updateMessage();
@@ -106,11 +143,40 @@ class Controller : public QObject {
     void finalTime(DroneModelItem *drone, qreal time);
     void startSockets();
     void tickLiveReference();
+    // emit solver signals coalesced since last display refresh
+    void flushSolverNotifications();
+    // move graphics from telemetry received since last refresh
+    void flushGraphics();
+    // receive ranked candidates from generator
+    void showCandidates();
+    // apply operator edit played from session
+    void applyEdit(int edit, double value);
 
  private:
     ConstraintModel *model_;
     ConstraintModel *loaded_model_;
 
+    // pool of compute threads solving drone contexts
+    SolverScheduler *solver_scheduler_;
+    // flushes solver signals and telemetry moves once per display
+    // refresh
+    QTimer *notify_timer_;
+    // moves graphics from telemetry updates once per flush
+    RepaintCoalescer *repaint_coalescer_;
+    // replanning rate and deadline for new drones
+    qreal replan_rate_;
+    qreal deadline_;
+    qreal anytime_budget_;
+
+    // multiple trajectories to choose from
+    CandidateGenerator *candidate_generator_;
+    // candidates shown, same order as canvas candidate graphics
+    QVector<Candidate> candidates_;
+    DroneModelItem *candidate_drone_;
+    // number of ranked candidates shown
+    static const int NUM_SHOWN_CANDIDATES = 3;
+    void clearCandidates();
+
     // configuration
     QVector<EllipseModelItem *> ellipses_;
     QVector<CylinderModelItem *> cylinders_;
@@ -125,39 +191,58 @@ class Controller : public QObject {
     qreal final_point_render_level_;
     qreal waypoints_render_level_;
     qreal traj_render_level_;
+    qreal candidate_render_level_;
 
     // flag for simulated traj
     bool is_simulated_;
     bool is_stage_booled_;
     bool traj_lock_;
 
+    // session recording and replay
+    SessionRecorder *session_recorder_;
+    SessionReplay *session_replay_;
+
     // Data capture
     bool capture_data_;
-    QFile *output_file_;
+    FlightRecorder *flight_recorder_;
     void createOutputFile();
     void updateOutputFile(const autogen::packet::traj2dof &traj,
                           DroneModelItem *staged_drone, int index);
 
-    // freeze traj timer
-    QTimer *freeze_traj_timer_;
-    quint32 traj_index_;
+    // executed traj node schedule
+    ReferenceClock *reference_clock_;
+    // node of executed traj last taken from clock
+    int traj_index_;
+
+    // receding horizon splicing in mpc mode
+    // traj version of staged drone last spliced or executed
+    quint64 splice_version_;
+    quint64 splices_;
+    quint64 splices_rejected_;
+    // max distance in meters from tracked reference point to start
+    // of a spliced horizon
+    static constexpr qreal MAX_SPLICE_JUMP = 0.5;
+    // horizons shorter than this in meters are not spliced
+    static constexpr qreal ARRIVAL_TOL = 0.1;
+    // ignore horizons solved before executing
+    void resetSplice();
+    // replace rest of executing trajectory with newest feasible
+    // horizon of staged drone and send it
+    void spliceHorizon();
+
+    // drones with solver contexts ordered by port, then by address,
+    // so stats rows keep their labels between refreshes
+    QList<DroneModelItem *> getStatsDrones();
 
     // network configuration dialog box
     PortDialog *port_dialog_;
     SaveDialog *save_dialog_;
     LoadDialog *load_dialog_;
-    QVector<DroneSocket *> drone_sockets_;
-    QVector<PointSocket *> final_point_sockets_;
-    QVector<WaypointSocket *> waypoint_sockets_;
-    QVector<EllipseSocket *> ellipse_sockets_;
-    QVector<CylinderSocket *> cylinder_sockets_;
-
-    // remove items
-    void removeDroneSocket(DroneModelItem *model);
-    void removeEllipseSocket(EllipseModelItem *model);
-    void removeCylinderSocket(CylinderModelItem *model);
-    void removePointSocket(PointModelItem *model);
-    void removeWaypointSocket(PointModelItem *model);
+    // sends executed trajectories to drones with a port
+    TrajectoryUplink *trajectory_uplink_;
+    // telemetry for all items with a port, on its own thread
+    NetworkIngest *network_ingest_;
+
     void closeSockets();
 
     // load graphical component from data model
@@ -0,0 +1,80 @@
+// TITLE:   Optimization_Interface/include/controls/flight_log.h
+// AUTHORS: Daniel Sullivan
+// LAB:     Autonomous Controls Lab (ACL)
+// LICENSE: Copyright 2020, All Rights Reserved
+
+// Binary columnar format of executed trajectory logs
+
+#ifndef FLIGHT_LOG_H_
+#define FLIGHT_LOG_H_
+
+#include <QIODevice>
+#include <QDataStream>
+#include <QStringList>
+#include <QVector>
+
+namespace optgui {
+
+// One reference tick of the executed trajectory, ned meters
+struct FlightRecord {
+    // wall clock msec since epoch
+    qint64 abs_time;
+    // rel_time, then ref and telem pos, vel and accl, named by
+    // FlightLogWriter::getColumns after abs_time
+    static const int NUM_VALUES = 19;
+    double values[NUM_VALUES];
+};
+
+// Little endian. Header is magic, version, column count, then name
+// and type of each column. Blocks follow until end of file, each is
+// a row count then every value of one column before the next column
+class FlightLogWriter {
+ public:
+    static const quint32 MAGIC = 0x4F46524C;  // "OFRL"
+    static const quint32 VERSION = 1;
+    // most rows in one block, larger counts are corrupt
+    static const int MAX_BLOCK_ROWS = 256;
+    enum COLUMN_TYPE {
+        INT64_COLUMN = 1,
+        FLOAT64_COLUMN = 2
+    };
+
+    // abs_time followed by names of record values
+    static QStringList getColumns();
+
+    // write header to device, false if it failed
+    bool open(QIODevice *device);
+    // write at most MAX_BLOCK_ROWS records as one block
+    bool writeBlock(QVector<FlightRecord> const &records);
+
+ private:
+    QDataStream stream_;
+};
+
+// Columns are matched by name, unknown ones are skipped and
+// missing ones read as zero
+class FlightLogReader {
+ public:
+    // read header from device, false if not a flight log
+    bool open(QIODevice *device);
+    // replace records with next block, false at end or on error
+    bool readBlock(QVector<FlightRecord> *records);
+    QString getError();
+
+ private:
+    struct Column {
+        quint8 type;
+        // -1 abs_time, -2 unknown, otherwise value index
+        int index;
+    };
+    static const int ABS_TIME_INDEX = -1;
+    static const int UNKNOWN_INDEX = -2;
+
+    QDataStream stream_;
+    QVector<Column> columns_;
+    QString error_;
+};
+
+}  // namespace optgui
+
+#endif  // FLIGHT_LOG_H_
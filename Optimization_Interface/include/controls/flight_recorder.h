@@ -0,0 +1,79 @@
+// TITLE:   Optimization_Interface/include/controls/flight_recorder.h
+// AUTHORS: Daniel Sullivan
+// LAB:     Autonomous Controls Lab (ACL)
+// LICENSE: Copyright 2020, All Rights Reserved
+
+// Writes executed trajectory logs on a background thread
+
+#ifndef FLIGHT_RECORDER_H_
+#define FLIGHT_RECORDER_H_
+
+#include <QThread>
+#include <QMutex>
+#include <QWaitCondition>
+#include <QFile>
+#include <QVector>
+#include <QAtomicInteger>
+
+#include "include/controls/flight_log.h"
+
+namespace optgui {
+
+// GUI thread pushes records into a single producer single consumer
+// ring without locks or allocation. The writer thread waits up to
+// WRITE_INTERVAL_MS between drains and writes full blocks, close wakes
+// it to write the last partial block at once. Records are dropped, not
+// blocked on, if the ring is full
+class FlightRecorder : public QThread {
+    Q_OBJECT
+
+ public:
+    FlightRecorder();
+    ~FlightRecorder();
+
+    // GUI thread, close any open log and start writing to filename,
+    // false if it could not be created
+    bool open(QString const &filename);
+    // GUI thread, write queued records and stop writer
+    void close();
+    bool isOpen();
+
+    // GUI thread, queue record, false if dropped
+    bool record(FlightRecord const &record);
+    // records dropped since open
+    quint64 getDropped();
+
+ protected:
+    void run() override;
+
+ private:
+    // ring capacity, far more than ticks between writer wakeups
+    static const int QUEUE_SIZE = 4096;
+    // rows per written block
+    static const int BLOCK_ROWS = FlightLogWriter::MAX_BLOCK_ROWS;
+    // writer wakeup period
+    static const unsigned long WRITE_INTERVAL_MS = 100;
+
+    QFile *file_;
+    FlightLogWriter writer_;
+
+    // ring written by GUI thread at head, read by writer at tail
+    QVector<FlightRecord> queue_;
+    QAtomicInt head_;
+    QAtomicInt tail_;
+    QAtomicInteger<quint64> dropped_;
+    // rows of block being filled, writer thread only
+    QVector<FlightRecord> block_;
+
+    // write loop flag, writer waits on stop between drains
+    bool run_loop_;
+    QMutex mutex_;
+    QWaitCondition stop_;
+
+    // move queued records to block, writing full blocks
+    void drainQueue();
+};
+
+}  // namespace optgui
+
+#endif  // FLIGHT_RECORDER_H_
@@ -0,0 +1,85 @@
+// TITLE:   Optimization_Interface/include/controls/reference_clock.h
+// AUTHORS: Daniel Sullivan
+// LAB:     Autonomous Controls Lab (ACL)
+// LICENSE: Copyright 2020, All Rights Reserved
+
+// Schedules executed trajectory nodes on the monotonic clock
+
+#ifndef REFERENCE_CLOCK_H_
+#define REFERENCE_CLOCK_H_
+
+#include <QThread>
+#include <QMutex>
+#include <QWaitCondition>
+#include <QVector>
+#include <QString>
+
+#include "autogen/lib.h"
+
+namespace optgui {
+
+// Node deadlines are absolute offsets of traj times from the start,
+// so a late wakeup delays one tick instead of every tick after it.
+// The clock thread sleeps to each deadline and signals the GUI
+// thread, which takes the node due at that moment by elapsed time.
+// A GUI thread that falls behind skips nodes rather than drifting
+class ReferenceClock : public QThread {
+    Q_OBJECT
+
+ public:
+    ReferenceClock();
+    ~ReferenceClock();
+
+    // GUI thread, node 0 of traj is due now, replaces any running
+    // schedule. One more deadline one node spacing after the last
+    // node ends the traj
+    void schedule(autogen::packet::traj2dof const &traj, int size);
+    // GUI thread, stop signalling and join thread
+    void stop();
+
+    // GUI thread, index of node due now, size of traj once ended
+    int takeIndex();
+
+    // jitter since last call, empty if no ticks
+    QString takeStatsText();
+
+ signals:
+    // a node is due, at most one pending at a time
+    void tick();
+
+ protected:
+    void run() override;
+
+ private:
+    // wait on condition until this close to deadline, then sleep
+    // the rest so wakeups are not rounded to msec
+    static const qint64 SLEEP_USEC = 2000;
+
+    // absolute monotonic usec of each node, then end of traj
+    QVector<qint64> deadlines_;
+    // next deadline to signal
+    int next_;
+    // tick emitted and not yet taken by GUI thread
+    bool is_pending_;
+
+    // lateness of clock thread wakeups past deadline
+    quint64 ticks_;
+    quint64 skipped_;
+    qint64 total_late_usec_;
+    qint64 max_late_usec_;
+    // lateness of GUI thread taking node past deadline
+    quint64 taken_;
+    qint64 total_taken_usec_;
+    qint64 max_taken_usec_;
+
+    // schedule loop flag
+    bool run_loop_;
+    // guards all of the above
+    QMutex mutex_;
+    // wakes thread for a new schedule or stop
+    QWaitCondition schedule_changed_;
+};
+
+}  // namespace optgui
+
+#endif  // REFERENCE_CLOCK_H_
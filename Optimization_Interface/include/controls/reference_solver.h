@@ -0,0 +1,49 @@
+// TITLE:   Optimization_Interface/include/controls/reference_solver.h
+// AUTHORS: Daniel Sullivan
+// LAB:     Autonomous Controls Lab (ACL)
+// LICENSE: Copyright 2020, All Rights Reserved
+
+// Cheap deterministic double integrator stand-in for profiling
+
+#ifndef REFERENCE_SOLVER_H_
+#define REFERENCE_SOLVER_H_
+
+#include "include/controls/trajectory_solver.h"
+
+namespace optgui {
+
+// Cubic Hermite spline through initial pos, waypoints and final pos
+// at their node indices, sampled on K nodes. Starts at initial vel,
+// stops at final pos. Ignores obstacles and bounds, always reports
+// zero relaxation so the rest of the pipeline sees a feasible traj.
+// Same inputs give the same outputs on every pass
+class ReferenceSolver : public TrajectorySolver {
+ public:
+    ReferenceSolver();
+
+    void setParams(skyenet::params &P,
+                   double r_i[3], double v_i[3],
+                   double a_i[3], double r_f[3],
+                   double wp[skyenet::MAX_WAYPOINTS][3]) override;
+    void resetInputs(double r_i[3], double v_i[3],
+                     double a_i[3], double r_f[3],
+                     double wp[skyenet::MAX_WAYPOINTS][3],
+                     bool free_final_time) override;
+    skyenet::outputs const &update(bool free_final_time) override;
+
+ private:
+    skyenet::params P_;
+    double r_i_[3];
+    double v_i_[3];
+    double r_f_[3];
+    double wp_[skyenet::MAX_WAYPOINTS][3];
+    skyenet::outputs O_;
+
+    // final time guess for free final time, from path length
+    // at half of max speed
+    double getFreeFinalTime();
+};
+
+}  // namespace optgui
+
+#endif  // REFERENCE_SOLVER_H_
@@ -0,0 +1,33 @@
+// TITLE:   Optimization_Interface/include/controls/skyefly_solver.h
+// AUTHORS: Daniel Sullivan
+// LAB:     Autonomous Controls Lab (ACL)
+// LICENSE: Copyright 2020, All Rights Reserved
+
+// Trajectory solver backed by skyenet SCvx
+
+#ifndef SKYEFLY_SOLVER_H_
+#define SKYEFLY_SOLVER_H_
+
+#include "include/controls/trajectory_solver.h"
+
+namespace optgui {
+
+class SkyeFlySolver : public TrajectorySolver {
+ public:
+    void setParams(skyenet::params &P,
+                   double r_i[3], double v_i[3],
+                   double a_i[3], double r_f[3],
+                   double wp[skyenet::MAX_WAYPOINTS][3]) override;
+    void resetInputs(double r_i[3], double v_i[3],
+                     double a_i[3], double r_f[3],
+                     double wp[skyenet::MAX_WAYPOINTS][3],
+                     bool free_final_time) override;
+    skyenet::outputs const &update(bool free_final_time) override;
+
+ private:
+    skyenet::SkyeFly fly_;
+};
+
+}  // namespace optgui
+
+#endif  // SKYEFLY_SOLVER_H_
@@ -0,0 +1,223 @@
+// TITLE:   Optimization_Interface/include/controls/solver_context.h
+// AUTHORS: Daniel Sullivan
+// LAB:     Autonomous Controls Lab (ACL)
+// LICENSE: Copyright 2020, All Rights Reserved
+
+// Per drone trajectory problem, solved by any compute thread in the pool
+
+#ifndef SOLVER_CONTEXT_H_
+#define SOLVER_CONTEXT_H_
+
+#include <QObject>
+#include <QMutex>
+#include <QAtomicInteger>
+#include <QElapsedTimer>
+#include <QVector3D>
+
+#include "cprs.h"
+#include "algorithm.h"
+
+#include "include/models/constraint_model.h"
+#include "include/controls/warm_start_cache.h"
+#include "include/controls/solver_stats.h"
+#include "include/graphics/path_graphics_item.h"
+#include "include/graphics/drone_graphics_item.h"
+#include "include/globals.h"
+
+namespace optgui {
+
+class SolverContext : public QObject {
+    Q_OBJECT
+
+ public:
+    explicit SolverContext(ConstraintModel *model,
+                           DroneGraphicsItem *drone,
+                           PathGraphicsItem *traj_graphic);
+    ~SolverContext();
+
+    PathGraphicsItem *getTrajGraphic();
+    void setTarget(PointModelItem *target);
+    // clear target and cached solves for it before it is deleted,
+    // only while no thread is solving context
+    void removeTarget(PointModelItem *target);
+    void reInit();
+    PointModelItem *getTarget();
+    DroneGraphicsItem *getDroneGraphic();
+    // number of solver passes run and skipped for unchanged inputs
+    quint64 getSolvesExecuted();
+    quint64 getSolvesSkipped();
+    // solver passes from a reset until trajectory settles,
+    // averaged over warm or cold starts
+    quint64 getNumStarts(bool is_warm_start);
+    qreal getMeanPassesToConverge(bool is_warm_start);
+    // per stage latency and iteration histograms
+    SolverStats *getStats();
+
+    // replanning rate in Hz, 0 solves as fast as possible
+    void setReplanRate(qreal rate);
+    qreal getReplanRate();
+    // time in ms after start of each replanning period by which
+    // the result should be shown, 0 for end of period
+    void setDeadline(qreal deadline);
+    qreal getDeadline();
+    // anytime mode runs single SCvx iterations for up to budget ms
+    // per pass and shows the best iterate so far, 0 to solve each
+    // pass to completion
+    void setAnytimeBudget(qreal budget);
+    qreal getAnytimeBudget();
+    // results discarded because inputs changed during the solve
+    quint64 getResultsDropped();
+    // results shown after their deadline
+    quint64 getDeadlineMisses();
+
+    // whether solve would do anything, called by scheduler
+    // only while context is not borrowed
+    bool hasWork();
+    // usec until solve should start to finish by next deadline,
+    // 0 if it can start now
+    qint64 getStartDelay();
+    // run one solver pass, only one thread at a time
+    void solve();
+
+    // emit signals posted by solves since last flush, called by
+    // parent thread at display refresh rate
+    void flushNotifications();
+
+ // slots for signals from context are run in parent thread
+ signals:
+    void updateGraphics(PathGraphicsItem *traj_graphic,
+                        DroneGraphicsItem *drone_graphic);
+    void updateMessage(DroneModelItem *drone);
+    void finalTime(DroneModelItem *drone, double final_time);
+
+ private:
+    // GUI data
+    ConstraintModel *model_;
+    // problem data, owned by cache
+    WarmStartCache warm_start_cache_;
+    TrajectorySolver *fly_;
+
+    // vehicle and target
+    DroneGraphicsItem *drone_;
+    PointModelItem *target_;
+    PathGraphicsItem *traj_graphic_;
+
+    // lock for accessing resources shared by compute threads and
+    // controller (target, reset flag, rate and notifications)
+    QMutex mutex_;
+
+    // flag to reset inputs
+    bool target_changed_;
+    // whether current trajectory was cleared while idle
+    bool is_cleared_;
+
+    // versions of inputs used for last solve
+    static const quint64 INVALID_VERSION = ~0ULL;
+    quint64 model_version_;
+    quint64 drone_generation_;
+    quint64 target_generation_;
+    // horizon and final time mode of params loaded into solver
+    quint32 horizon_;
+    bool is_free_final_time_;
+
+    // warm start refinement passes run after inputs stop changing,
+    // raised to max SCvx iterations in anytime mode
+    static const quint32 MAX_REFINE_PASSES = 10;
+    quint32 max_refine_passes_;
+    quint32 refine_passes_;
+    // convergence tolerances in pixels and seconds
+    static constexpr qreal CONVERGED_POS_TOL = 1.0;
+    static constexpr qreal CONVERGED_TIME_TOL = 0.001;
+    bool is_converged_;
+    QVector<QPointF> last_trajectory_;
+    qreal last_final_time_;
+    // check if trajectory moved since last pass and save it
+    bool isConverged(QVector<QPointF> const &trajectory, qreal final_time);
+
+    // solve counters
+    QAtomicInteger<quint64> solves_executed_;
+    QAtomicInteger<quint64> solves_skipped_;
+
+    // passes to converge after reset, split by warm or cold start
+    bool is_counting_passes_;
+    bool is_warm_start_;
+    quint32 passes_since_reset_;
+    QAtomicInteger<quint64> warm_starts_;
+    QAtomicInteger<quint64> warm_start_passes_;
+    QAtomicInteger<quint64> cold_starts_;
+    QAtomicInteger<quint64> cold_start_passes_;
+
+    // latency of solve passes, recorded by compute threads
+    SolverStats stats_;
+
+    // replanning period and deadline in usec, 0 if ungoverned
+    qint64 period_;
+    qint64 deadline_;
+    // monotonic clock for replanning periods
+    QElapsedTimer clock_;
+    // start of current replanning period in usec on clock
+    qint64 period_start_;
+    // smoothed solve duration in usec, to start before deadline
+    qint64 solve_estimate_;
+    // weight of newest solve in estimate
+    static constexpr qreal SOLVE_ESTIMATE_GAIN = 0.2;
+    // margin on estimate for jitter
+    static constexpr qreal SOLVE_ESTIMATE_MARGIN = 1.5;
+    // time last result was shown in usec on clock
+    qint64 last_publish_;
+    // max usec without showing a result when ungoverned, stale
+    // results are shown anyway after this long
+    static const qint64 MAX_STALE_USEC = 100000;
+    // newer telemetry alone only makes a result stale once the drone
+    // is this many meters from the start it was solved from
+    static constexpr qreal STALE_POS_TOL = 0.05;
+    // predicted start of last input change in pixels
+    QVector3D start_pos_;
+    QAtomicInteger<quint64> results_dropped_;
+    QAtomicInteger<quint64> deadline_misses_;
+    // move to period after one just solved
+    void finishPeriod(qint64 now);
+
+    // anytime budget in usec, 0 if off
+    qint64 anytime_budget_;
+    // SCvx iterations per solver update in anytime mode
+    static const quint32 ANYTIME_ITERATIONS = 1;
+    // anytime budget in usec used while replanning an executing
+    // trajectory in mpc mode if none is set
+    static const qint64 MPC_BUDGET_USEC = 20000;
+    // lowest relaxation iterate since inputs changed
+    skyenet::outputs best_;
+    double best_relaxation_;
+    // keep iterate if relaxations are no worse than best
+    void keepBest(skyenet::outputs const &O);
+
+    // signals waiting for next flush
+    bool is_graphics_pending_;
+    bool is_message_pending_;
+    bool is_final_time_pending_;
+    double pending_final_time_;
+    void postGraphics();
+    void postMessage();
+    void postFinalTime(double final_time);
+
+    // get and clear flag to reset solver inputs
+    bool takeTargetChanged();
+    bool isTargetChanged();
+    // whether any input changed since last solve
+    bool isInputsChanged(PointModelItem *target);
+    // whether inputs changed during solve enough to drop the result
+    bool isResultStale(PointModelItem *target);
+
+    INPUT_CODE validateInputs(ConstraintSnapshot const &snapshot,
+                              QVector3D const &initial_pos,
+                              QVector3D const &final_pos);
+    // exact test for point in meters inside ellipse obstacle
+    bool isInsideEllipse(skyenet::params const &P,
+                         quint32 index, qreal x, qreal y);
+    // converging trajectories are drawn dashed
+    void setFeasibilityColor(bool is_feasible, bool is_converging);
+};
+
+}  // namespace optgui
+
+#endif  // SOLVER_CONTEXT_H_
@@ -0,0 +1,44 @@
+// TITLE:   Optimization_Interface/include/controls/solver_outputs.h
+// AUTHORS: Daniel Sullivan
+// LAB:     Autonomous Controls Lab (ACL)
+// LICENSE: Copyright 2020, All Rights Reserved
+
+// Reading solver outputs, shared by GUI and batch solves
+
+#ifndef SOLVER_OUTPUTS_H_
+#define SOLVER_OUTPUTS_H_
+
+#include <QVector>
+#include <QPointF>
+
+#include "cprs.h"
+#include "algorithm.h"
+#include "autogen/lib.h"
+
+#include "include/controls/trajectory_solver.h"
+
+namespace optgui {
+    // convert solver outputs to GUI points and mikipilot packet,
+    // trajectory is resized to size and overwritten
+    void readTrajectory(skyenet::outputs const &O, quint32 size,
+                        QVector<QPointF> *trajectory,
+                        autogen::packet::traj2dof *traj2dof);
+
+    // sum of squared initial, final and time relaxations
+    double getRelaxation(skyenet::outputs const &O);
+    // whether initial, final and time relaxations are small enough
+    bool isFeasible(skyenet::outputs const &O);
+
+    // largest acceleration magnitude in m/s^2
+    double getPeakAccel(skyenet::outputs const &O, quint32 size);
+
+    // run passes on initialized solver until trajectory stops
+    // moving or max passes, passes run is stored in passes
+    skyenet::outputs const &solveUntilConverged(TrajectorySolver *fly,
+                                                quint32 size,
+                                                bool is_free_final_time,
+                                                quint32 max_passes,
+                                                quint32 *passes);
+}  // namespace optgui
+
+#endif  // SOLVER_OUTPUTS_H_
@@ -0,0 +1,70 @@
+// TITLE:   Optimization_Interface/include/controls/solver_scheduler.h
+// AUTHORS: Daniel Sullivan
+// LAB:     Autonomous Controls Lab (ACL)
+// LICENSE: Copyright 2020, All Rights Reserved
+
+// Fixed pool of compute threads sharing per drone solver contexts
+
+#ifndef SOLVER_SCHEDULER_H_
+#define SOLVER_SCHEDULER_H_
+
+#include <QVector>
+#include <QMutex>
+#include <QWaitCondition>
+
+#include "include/models/constraint_model.h"
+#include "include/controls/solver_context.h"
+
+namespace optgui {
+
+class ComputeThread;
+
+class SolverScheduler {
+ public:
+    // start pool sized to hardware, at least one thread
+    explicit SolverScheduler(ConstraintModel *model);
+    // stop and join compute threads, delete contexts
+    ~SolverScheduler();
+
+    // caller keeps pointer for lookup, scheduler owns context
+    void addContext(SolverContext *context);
+    // blocks until no thread is solving context, then deletes it
+    void removeContext(SolverContext *context);
+    // blocks until no thread is solving each context, then clears
+    // target from it, target can be deleted after return
+    void removeTarget(PointModelItem *target);
+
+    // borrow next context with work, priority drones first then
+    // round robin, nullptr if nothing to do. Contexts with a
+    // replanning rate wait until they must start to meet their
+    // deadline, wait_usec is set to the soonest start
+    SolverContext *acquire(qint64 *wait_usec);
+    // return borrowed context
+    void release(SolverContext *context);
+
+    int getNumThreads();
+    // wakeups of all threads while idle, see ComputeThread
+    quint64 getIdleWakeups();
+
+ private:
+    ConstraintModel *model_;
+    QVector<ComputeThread *> threads_;
+
+    // lock for contexts and borrowed flags
+    QMutex mutex_;
+    // signalled when a context is released
+    QWaitCondition released_;
+    QVector<SolverContext *> contexts_;
+    QVector<SolverContext *> borrowed_;
+    // next context to check for round robin
+    int cursor_;
+    // whether priority drones are checked first on next acquire
+    bool is_priority_turn_;
+
+    // selected drone and drone with staged or executed traj
+    bool isPriority(SolverContext *context);
+};
+
+}  // namespace optgui
+
+#endif  // SOLVER_SCHEDULER_H_
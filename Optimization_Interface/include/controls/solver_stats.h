@@ -0,0 +1,91 @@
+// TITLE:   Optimization_Interface/include/controls/solver_stats.h
+// AUTHORS: Daniel Sullivan
+// LAB:     Autonomous Controls Lab (ACL)
+// LICENSE: Copyright 2020, All Rights Reserved
+
+// Per drone solve latency histograms and rates
+
+#ifndef SOLVER_STATS_H_
+#define SOLVER_STATS_H_
+
+#include <QAtomicInteger>
+#include <QElapsedTimer>
+#include <QString>
+#include <QTextStream>
+
+namespace optgui {
+
+// Log linear histogram, 8 linear buckets per power of two so any
+// value is within 12.5% of its bucket. Recording is lock free and
+// safe from one writer while others read
+class Histogram {
+ public:
+    Histogram();
+
+    void record(quint64 value);
+
+    quint64 getCount() const;
+    quint64 getMax() const;
+    double getMean() const;
+    // upper bound of bucket holding quantile q in [0, 1]
+    quint64 getPercentile(double q) const;
+
+    // write non empty buckets as prefix,low,high,count rows
+    void writeBuckets(QTextStream *stream, QString const &prefix) const;
+
+ private:
+    static const int SUB_BUCKETS = 8;
+    static const int NUM_BUCKETS = SUB_BUCKETS * 62;
+
+    QAtomicInteger<quint64> counts_[NUM_BUCKETS];
+    QAtomicInteger<quint64> count_;
+    QAtomicInteger<quint64> sum_;
+    QAtomicInteger<quint64> max_;
+
+    static int getBucket(quint64 value);
+    // bucket covers [low, high)
+    static quint64 getBucketLow(int bucket);
+    static quint64 getBucketHigh(int bucket);
+};
+
+class SolverStats {
+ public:
+    // timed stages of one solve pass
+    enum STAGE {
+        PARAMS,    // snapshot and solver input assembly
+        VALIDATE,  // input validation
+        SOLVE,     // solver update
+        CONVERT,   // outputs to GUI points and traj2dof
+        EMIT,      // model update and signals
+        TOTAL,
+        NUM_STAGES
+    };
+
+    SolverStats();
+
+    // time stage in microseconds since timer started, restart timer
+    void lap(STAGE stage, QElapsedTimer *timer);
+    void record(STAGE stage, quint64 usec);
+    // passes from reset until trajectory settles
+    void recordIterations(quint32 passes);
+
+    Histogram const &getLatency(STAGE stage) const;
+    Histogram const &getIterations() const;
+    quint64 getSolves() const;
+    // solves per second since last call, only call from one thread
+    double takeSolveRate();
+
+    static QString getStageName(STAGE stage);
+
+ private:
+    Histogram latency_[NUM_STAGES];
+    Histogram iterations_;
+
+    // rate sampling, reader thread only
+    QElapsedTimer rate_timer_;
+    quint64 rate_solves_;
+};
+
+}  // namespace optgui
+
+#endif  // SOLVER_STATS_H_
@@ -0,0 +1,45 @@
+// TITLE:   Optimization_Interface/include/controls/trajectory_solver.h
+// AUTHORS: Daniel Sullivan
+// LAB:     Autonomous Controls Lab (ACL)
+// LICENSE: Copyright 2020, All Rights Reserved
+
+// Interface for trajectory solver backends
+
+#ifndef TRAJECTORY_SOLVER_H_
+#define TRAJECTORY_SOLVER_H_
+
+#include "cprs.h"
+#include "algorithm.h"
+
+namespace optgui {
+
+// Same calls as skyenet::SkyeFly. setParams keeps the current iterate
+// so the next update warm starts from it, resetInputs discards it.
+// One instance is used by one thread at a time
+class TrajectorySolver {
+ public:
+    virtual ~TrajectorySolver() {}
+
+    // load problem, keeps current iterate
+    virtual void setParams(skyenet::params &P,
+                           double r_i[3], double v_i[3],
+                           double a_i[3], double r_f[3],
+                           double wp[skyenet::MAX_WAYPOINTS][3]) = 0;
+    // cold start from straight line initial guess
+    virtual void resetInputs(double r_i[3], double v_i[3],
+                             double a_i[3], double r_f[3],
+                             double wp[skyenet::MAX_WAYPOINTS][3],
+                             bool free_final_time) = 0;
+    // run one pass from current iterate, outputs are valid
+    // until next call
+    virtual skyenet::outputs const &update(bool free_final_time) = 0;
+
+    // new solver of backend selected at build or run time. Built
+    // without skyenet always gives reference solver, otherwise
+    // OPTGUI_SOLVER=reference selects it
+    static TrajectorySolver *create();
+};
+
+}  // namespace optgui
+
+#endif  // TRAJECTORY_SOLVER_H_
@@ -0,0 +1,75 @@
+// TITLE:   Optimization_Interface/include/controls/warm_start_cache.h
+// AUTHORS: Daniel Sullivan
+// LAB:     Autonomous Controls Lab (ACL)
+// LICENSE: Copyright 2020, All Rights Reserved
+
+// Small LRU cache of solver instances keyed by target and waypoints
+
+#ifndef WARM_START_CACHE_H_
+#define WARM_START_CACHE_H_
+
+#include <QVector>
+
+#include "include/models/point_model_item.h"
+#include "include/controls/trajectory_solver.h"
+
+namespace optgui {
+
+// Each entry keeps a solver holding the last iterate solved for its
+// key, so switching back to a target or changing waypoints continues
+// from a converged trajectory instead of resetting inputs.
+// Not locked, owned by one solver context
+class WarmStartCache {
+ public:
+    enum MATCH {
+        EXACT_MATCH,
+        NEAREST_MATCH,
+        NO_MATCH
+    };
+
+    WarmStartCache();
+    ~WarmStartCache();
+
+    // get solver for key, reusing the exact or nearest entry or
+    // evicting the least recently used. Entry is re-keyed in place.
+    // match is set to how the entry was found, solver must be reset
+    // when NO_MATCH
+    TrajectorySolver *lookup(PointModelItem *target,
+                             quint64 waypoint_key,
+                             quint32 horizon,
+                             double const r_f[3],
+                             MATCH *match);
+
+    // update final pos of entry for solver after a solve
+    void update(TrajectorySolver *fly, double const r_f[3]);
+    // forget deleted target so a new item at its address never
+    // matches exactly, its entries are evicted first
+    void removeTarget(PointModelItem *target);
+
+ private:
+    struct Entry {
+        PointModelItem *target;
+        quint64 waypoint_key;
+        quint32 horizon;
+        // final pos in meters
+        double r_f[3];
+        TrajectorySolver *fly;
+        // lookup count when last used
+        quint64 last_used;
+    };
+
+    // max cached solvers per drone
+    static const int CAPACITY = 4;
+    // max distance in meters between targets to warm start
+    // with different target and same waypoints
+    static constexpr double NEAREST_RADIUS = 2.0;
+
+    QVector<Entry> entries_;
+    quint64 clock_;
+
+    static double distance(double const a[3], double const b[3]);
+};
+
+}  // namespace optgui
+
+#endif  // WARM_START_CACHE_H_
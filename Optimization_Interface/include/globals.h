@@ -49,7 +49,8 @@ namespace optgui {
         POINT_GRAPHIC = QGraphicsItem::UserType + 8,
         DRONE_GRAPHIC = QGraphicsItem::UserType + 9,
         CYLINDER_HANDLE_GRAPHIC = QGraphicsItem::UserType + 10,
-        CYLINDER_GRAPHIC = QGraphicsItem::UserType + 11
+        CYLINDER_GRAPHIC = QGraphicsItem::UserType + 11,
+        CANDIDATE_GRAPHIC = QGraphicsItem::UserType + 12
     };
 
     // Traj feasibility
@@ -73,6 +74,10 @@ namespace optgui {
     QVector3D guiXyzToXyz(qreal x, qreal y, qreal z);
     QVector3D xyzToGuiXyz(QVector3D const &xyz_coords);
     QVector3D xyzToGuiXyz(qreal x, qreal y, qreal z);
+
+    // monotonic time in usec shared by all threads, for stamping
+    // telemetry and predicting vehicle state
+    qint64 getMonotonicUsec();
 }  // namespace optgui
 
 #endif  // GLOBALS_H_
@@ -0,0 +1,62 @@
+// TITLE:   Optimization_Interface/include/graphics/candidate_graphics_item.h
+// AUTHORS: Daniel Sullivan
+// LAB:     Autonomous Controls Lab (ACL)
+// LICENSE: Copyright 2020, All Rights Reserved
+
+// Graphical representation for a selectable candidate trajectory
+
+#ifndef CANDIDATE_GRAPHICS_ITEM_H_
+#define CANDIDATE_GRAPHICS_ITEM_H_
+
+#include <QGraphicsItem>
+#include <QPainter>
+#include <QVector>
+#include <QPointF>
+
+#include "include/globals.h"
+
+namespace optgui {
+
+class CandidateGraphicsItem : public QGraphicsItem {
+ public:
+    explicit CandidateGraphicsItem(QVector<QPointF> points,
+                                   quint32 rank,
+                                   bool is_feasible,
+                                   QGraphicsItem *parent = nullptr,
+                                   quint32 size = 3);
+    // rough area of graphic
+    QRectF boundingRect() const override;
+    // recompute cached area after model or zoom changes
+    void updateGeometry();
+    // draw graphic
+    void paint(QPainter *painter, const QStyleOptionGraphicsItem *option,
+               QWidget *widget = nullptr) override;
+    // unique type for graphic
+    int type() const override;
+
+    // position of candidate in ranking, best is 0
+    quint32 getRank();
+
+ protected:
+    // shape for selecting, wider than line
+    QPainterPath shape() const override;
+    // rescale area when added to scene
+    QVariant itemChange(GraphicsItemChange change,
+                        const QVariant &value) override;
+
+ private:
+    // area in item coords, cached so scene index stays valid
+    QRectF bounds_;
+    QRectF getBounds() const;
+
+    // points in scene coords, fixed once solved
+    QVector<QPointF> points_;
+    quint32 rank_;
+    QPen pen_;
+    quint32 width_;
+    qreal getScalingFactor() const;
+};
+
+}  // namespace optgui
+
+#endif  // CANDIDATE_GRAPHICS_ITEM_H_
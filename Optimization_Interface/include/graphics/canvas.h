@@ -10,8 +10,11 @@
 
 #include <QGraphicsScene>
 #include <QFont>
+#include <QCache>
+#include <QPixmap>
 
 #include "include/graphics/path_graphics_item.h"
+#include "include/graphics/candidate_graphics_item.h"
 #include "include/graphics/drone_graphics_item.h"
 #include "include/graphics/waypoint_graphics_item.h"
 #include "include/graphics/point_graphics_item.h"
@@ -19,6 +22,7 @@
 #include "include/graphics/cylinder_graphics_item.h"
 #include "include/graphics/polygon_graphics_item.h"
 #include "include/graphics/plane_graphics_item.h"
+#include "include/graphics/image_pyramid.h"
 
 namespace optgui {
 
@@ -32,8 +36,17 @@ class Canvas : public QGraphicsScene {
     // render item at top level
     void bringToFront(QGraphicsItem *item);
 
+    // recompute cached areas of all graphics, needed after changes
+    // to zoom or shared model state that resize them
+    void updateGeometry();
+    // toggle BSP tree index for hit tests and culling, linear
+    // search over all items when off
+    void setIndexed(bool is_indexed);
+
     QSet<PathGraphicsItem *> path_graphics_;
     PathGraphicsItem *path_staged_graphic_;
+    // candidate trajs in ranked order
+    QVector<CandidateGraphicsItem *> candidate_graphics_;
 
     QSet<DroneGraphicsItem *> drone_graphics_;
     QVector<EllipseGraphicsItem *> ellipse_graphics_;
@@ -58,7 +71,18 @@ class Canvas : public QGraphicsScene {
  private:
     qreal getScalingFactor();
     void setBackgroundImage(QString filename);
-    QImage background_image_;
+    ImagePyramid background_;
+
+    // grid lines and origin label drawn once into screen aligned
+    // tiles, repaints only blit them. Cleared when zoom changes
+    static const qint32 GRID_TILE_SIZE = 256;
+    static const int MAX_GRID_TILES = 128;
+    QCache<quint64, QPixmap> grid_tiles_;
+    qreal grid_tiles_zoom_;
+    // cached pixmap of tile, valid until next call
+    QPixmap *getGridTile(qint32 col, qint32 row, qreal zoom);
+    // stroke grid lines over rect in scene coords
+    void drawGrid(QPainter *painter, const QRectF &rect);
 
     // member variables for graphical style
     QPen background_pen_;
@@ -30,6 +30,8 @@ class CylinderGraphicsItem : public QGraphicsItem {
 
     // rough area of graphic
     QRectF boundingRect() const override;
+    // recompute cached area after model or zoom changes
+    void updateGeometry();
 
     // draw graphic
     void paint(QPainter *painter, const QStyleOptionGraphicsItem *option,
@@ -56,6 +58,10 @@ class CylinderGraphicsItem : public QGraphicsItem {
                         const QVariant &value) override;
 
  private:
+    // area in item coords, cached so scene index stays valid
+    QRectF bounds_;
+    QRectF getBounds() const;
+
     QPen pen_;
     QPen clearance_pen_;
     QBrush brush_;
@@ -23,6 +23,8 @@ class DroneGraphicsItem : public QGraphicsItem {
                                qreal size = 20);
     // rough area of graphic
     QRectF boundingRect() const override;
+    // recompute cached area after model or zoom changes
+    void updateGeometry();
 
     // draw graphic
     void paint(QPainter *painter, const QStyleOptionGraphicsItem *option,
@@ -47,6 +49,10 @@ class DroneGraphicsItem : public QGraphicsItem {
                        const QVariant &value) override;
 
  private:
+    // area in item coords, cached so scene index stays valid
+    QRectF bounds_;
+    QRectF getBounds() const;
+
     QPen pen_;
     QBrush brush_;
 
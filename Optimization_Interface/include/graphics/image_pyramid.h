@@ -0,0 +1,54 @@
+// TITLE:   Optimization_Interface/include/graphics/image_pyramid.h
+// AUTHORS: Daniel Sullivan
+// LAB:     Autonomous Controls Lab (ACL)
+// LICENSE: Copyright 2020, All Rights Reserved
+
+// Tiled levels of detail of a large image, for drawing map backgrounds
+
+#ifndef IMAGE_PYRAMID_H_
+#define IMAGE_PYRAMID_H_
+
+#include <QImage>
+#include <QPixmap>
+#include <QPainter>
+#include <QCache>
+#include <QVector>
+
+namespace optgui {
+
+// Image is halved until it fits one tile. Drawing picks the smallest
+// level with at least one image pixel per screen pixel and blits only
+// the tiles overlapping the exposed area. Tiles are converted to
+// pixmaps on first use and kept in a bounded cache. GUI thread only
+class ImagePyramid {
+ public:
+    ImagePyramid();
+
+    // build levels of image covering area in scene coords
+    void setImage(QImage const &image, QRectF const &area);
+    bool isNull() const;
+
+    // draw part of image inside rect, scale is screen pixels per
+    // scene unit
+    void draw(QPainter *painter, QRectF const &rect, qreal scale);
+
+ private:
+    // tile edge in image pixels
+    static const int TILE_SIZE = 256;
+    // max tile pixmaps kept, 256 KB each
+    static const int MAX_CACHED_TILES = 128;
+
+    // level 0 is full resolution
+    QVector<QImage> levels_;
+    QRectF area_;
+    QCache<quint64, QPixmap> tiles_;
+
+    // coarsest level still as sharp as the screen
+    int getLevel(qreal scale) const;
+    // cached pixmap of tile, valid until next call
+    QPixmap *getTile(int level, int col, int row);
+};
+
+}  // namespace optgui
+
+#endif  // IMAGE_PYRAMID_H_
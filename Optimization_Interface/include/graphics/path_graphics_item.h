@@ -10,6 +10,7 @@
 
 #include <QGraphicsItem>
 #include <QPainter>
+#include <QAtomicInteger>
 
 #include "include/globals.h"
 #include "include/models/path_model_item.h"
@@ -23,11 +24,16 @@ class PathGraphicsItem : public QGraphicsItem {
                               quint32 size = 4);
     // rough area of graphic
     QRectF boundingRect() const override;
+    // take latest model frame and recompute cached area and shape
+    // if it or zoom changed, GUI thread only
+    void updateGeometry();
     // draw graphic
     void paint(QPainter *painter, const QStyleOptionGraphicsItem *option,
                QWidget *widget = nullptr) override;
-    // set color of traj
+    // set color of traj, safe from compute threads
     void setColor(QColor);
+    // dashed while showing an intermediate solver iterate
+    void setConverging(bool is_converging);
 
     PathModelItem *model_;
 
@@ -42,8 +48,17 @@ class PathGraphicsItem : public QGraphicsItem {
     QPen pen_;
     QPen waypoints_pen_;
     quint32 width_;
-    QMutex mutex_;  // mutex lock for compute thread setting color
+    // style set by compute threads, read when painting
+    QAtomicInteger<quint32> rgba_;
+    QAtomicInt is_converging_;
     qreal getScalingFactor() const;
+
+    // shape and area of model trajectory version and zoom, rebuilt
+    // when either changes. Cached so scene index stays valid
+    QPainterPath shape_;
+    QRectF bounds_;
+    quint64 shape_version_;
+    qreal shape_scale_;
 };
 
 }  // namespace optgui
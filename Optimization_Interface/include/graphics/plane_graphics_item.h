@@ -29,6 +29,8 @@ class PlaneGraphicsItem : public QGraphicsItem {
 
     // rough area of graphic
     QRectF boundingRect() const override;
+    // recompute cached area after model or zoom changes
+    void updateGeometry();
     // draw shape
     void paint(QPainter *painter, const QStyleOptionGraphicsItem *option,
                QWidget *widget = nullptr) override;
@@ -46,6 +48,10 @@ class PlaneGraphicsItem : public QGraphicsItem {
                         const QVariant &value) override;
 
  private:
+    // area in item coords, cached so scene index stays valid
+    QRectF bounds_;
+    QRectF getBounds() const;
+
     QPen pen_;
     QBrush brush_;
 
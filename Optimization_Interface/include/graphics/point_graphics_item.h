@@ -24,6 +24,8 @@ class PointGraphicsItem : public QGraphicsItem {
 
     // rough area of graphic
     QRectF boundingRect() const override;
+    // recompute cached area after model or zoom changes
+    void updateGeometry();
     // draw graphic
     void paint(QPainter *painter, const QStyleOptionGraphicsItem *option,
                QWidget *widget = nullptr) override;
@@ -38,6 +40,10 @@ class PointGraphicsItem : public QGraphicsItem {
                         const QVariant &value) override;
 
  private:
+    // area in item coords, cached so scene index stays valid
+    QRectF bounds_;
+    QRectF getBounds() const;
+
     // size of graphic
     qreal radius_;
 
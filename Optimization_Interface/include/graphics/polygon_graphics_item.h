@@ -29,6 +29,8 @@ class PolygonGraphicsItem : public QGraphicsItem {
 
     // rough area of graphic
     QRectF boundingRect() const override;
+    // recompute cached area after model or zoom changes
+    void updateGeometry();
     // draw graphic
     void paint(QPainter *painter, const QStyleOptionGraphicsItem *option,
                QWidget *widget = 0) override;
@@ -46,6 +48,10 @@ class PolygonGraphicsItem : public QGraphicsItem {
                         const QVariant &value) override;
 
  private:
+    // area in item coords, cached so scene index stays valid
+    QRectF bounds_;
+    QRectF getBounds() const;
+
     QPen pen_;
     QBrush brush_;
 
@@ -0,0 +1,70 @@
+// TITLE:   Optimization_Interface/include/graphics/repaint_coalescer.h
+// AUTHORS: Daniel Sullivan
+// LAB:     Autonomous Controls Lab (ACL)
+// LICENSE: Copyright 2020, All Rights Reserved
+
+// Batches graphics moves from network sockets into one repaint per tick
+
+#ifndef REPAINT_COALESCER_H_
+#define REPAINT_COALESCER_H_
+
+#include <QObject>
+#include <QGraphicsScene>
+#include <QGraphicsItem>
+#include <QElapsedTimer>
+#include <QHash>
+#include <QRegion>
+#include <QVector>
+
+namespace optgui {
+
+// Sockets update models as datagrams arrive and post the new pose of
+// their graphic here. Each flush applies the latest pose of every
+// posted item once and repaints only the merged old and new bounds of
+// items that actually moved, so scene repaints follow the flush rate
+// instead of the datagram rate. GUI thread only
+class RepaintCoalescer : public QObject {
+    Q_OBJECT
+
+ public:
+    explicit RepaintCoalescer(QGraphicsScene *scene,
+                              QObject *parent = nullptr);
+
+    // drop pending pose of item, call before item is deleted
+    void removeItem(QGraphicsItem *item);
+    // count a view repaint, region in viewport pixels
+    void recordPaint(QRegion const &region);
+    // flushes, repaints and painted area per second since last call
+    QString takeStatsText();
+
+ public slots:
+    // set pose of item on next flush, replaces earlier pending pose
+    void moveItem(QGraphicsItem *item, QPointF pos, qreal rotation);
+    // apply pending poses and repaint their area, called by parent
+    // at display refresh rate
+    void flush();
+
+ private:
+    struct Pose {
+        QPointF pos;
+        qreal rotation;
+    };
+
+    QGraphicsScene *scene_;
+    QHash<QGraphicsItem *, Pose> pending_;
+    // dirty rects in scene coords, reused between flushes
+    QVector<QRectF> dirty_;
+
+    // counts since stats were last taken
+    QElapsedTimer stats_clock_;
+    quint64 flushes_;
+    quint64 repaints_;
+    qreal painted_area_;
+
+    // add rect to dirty rects, merging it with any it overlaps
+    void addDirty(QRectF rect);
+};
+
+}  // namespace optgui
+
+#endif  // REPAINT_COALESCER_H_
@@ -16,6 +16,8 @@
 #include <QHeaderView>
 #include <QGestureEvent>
 #include <QDoubleSpinBox>
+#include <QCheckBox>
+#include <QTimer>
 
 #include "algorithm.h"
 
@@ -42,6 +44,10 @@ class View : public QGraphicsView {
     void resizeEvent(QResizeEvent *event) override;
     // handle mouse input for toggle mode
     void mousePressEvent(QMouseEvent *event) override;
+    // count repaints for stats
+    void paintEvent(QPaintEvent *event) override;
+    // repaint all when panning, foreground is fixed to viewport
+    void scrollContentsBy(int dx, int dy) override;
 
  private slots:
     // open/close side menu
@@ -74,11 +80,16 @@ class View : public QGraphicsView {
     void stageTraj();
     void unstageTraj();
 
+    // solve multiple trajectories to choose from
+    void generateCandidates();
+
     // save all params in expert panel
     void setSkyeFlyParams();
 
     // set final time
     void setFinaltime(qreal final_time);
+    // show final time without setting it
+    void showFinaltime(qreal final_time);
 
     // duplicate currently selected item
     void duplicateSelected();
@@ -86,6 +97,12 @@ class View : public QGraphicsView {
     // set clearance around ellipses (in meters)
     void setClearance(qreal clearance);
 
+    // set replanning rate in Hz and deadline in ms
+    void setReplanRate(qreal rate);
+    void setDeadline(qreal deadline);
+    // set anytime solve budget in ms
+    void setAnytimeBudget(qreal budget);
+
     // set upper/lower bounds on waypoint index
     // when K is changed
     void constrainWpIdx(int value);
@@ -100,8 +117,18 @@ class View : public QGraphicsView {
     void toggleSim(int);
     void toggleStage(int);
     void toggleTrajLock(int);
+    void toggleMpc(int);
     void toggleFreeFinalTime(int);
     void toggleDataCapture(int);
+    void toggleSpatialIndex(int);
+    void toggleSessionRecording(int);
+    // play a recorded session through telemetry ingest
+    void replaySession();
+
+    // refresh solver stats in expert panel
+    void updateSolverStats();
+    // save solver latency histograms to csv
+    void dumpSolverStats();
 
   private:
     void initializeMenuPanel();
@@ -147,6 +174,11 @@ class View : public QGraphicsView {
     quint32 a_max_row;
     quint32 wp_idx_row;
     QTableWidget *model_params_table_;
+    QLabel *solver_stats_label_;
+    QCheckBox *session_record_toggle_;
+    QCheckBox *fast_replay_toggle_;
+    QDoubleSpinBox *finaltime_box_;
+    QTimer *solver_stats_timer_;
 
     // keep track of all widgets to delete them
     QVector<QWidget *> panel_widgets_;
@@ -169,17 +201,24 @@ class View : public QGraphicsView {
     void initializeFlipButton(MenuPanel *panel);
     void initializeExecButton(MenuPanel *panel);
     void initializeStageButton(MenuPanel *panel);
+    void initializeCandidatesButton(MenuPanel *panel);
     void initializeFinaltime(MenuPanel *panel);
     void initializeDuplicateButton(MenuPanel *panel);
     void initializeStageToggle(MenuPanel *panel);
     void initializeSimToggle(MenuPanel *panel);
     void initializeTrajLockToggle(MenuPanel *panel);
+    void initializeMpcToggle(MenuPanel *panel);
     void initializeFreeFinalTimeToggle(MenuPanel *panel);
     // expert panel skyefly params
     void initializeSkyeFlyParamsTable(MenuPanel *panel);
     void initializeDataCaptureToggle(MenuPanel *panel);
+    void initializeSpatialIndexToggle(MenuPanel *panel);
+    // expert panel session recording and replay
+    void initializeSessionControls(MenuPanel *panel);
     // expert panel constraint_model params not in skyefly
     void initializeModelParamsTable(MenuPanel *panel);
+    // expert panel solve rate and latency percentiles
+    void initializeSolverStats(MenuPanel *panel);
 };
 
 }  // namespace optgui
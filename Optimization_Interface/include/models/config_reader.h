@@ -0,0 +1,28 @@
+// TITLE:   Optimization_Interface/include/models/config_reader.h
+// AUTHORS: Daniel Sullivan
+// LAB:     Autonomous Controls Lab (ACL)
+// LICENSE: Copyright 2020, All Rights Reserved
+
+// Reads config files written by save dialog into a model, no GUI
+
+#ifndef CONFIG_READER_H_
+#define CONFIG_READER_H_
+
+#include <QString>
+
+#include "include/models/constraint_model.h"
+
+namespace optgui {
+
+class ConfigReader {
+ public:
+    // add items in config file to model, model owns them.
+    // Returns false and sets error if file cannot be opened
+    static bool readConfig(QString const &file_name,
+                           ConstraintModel *model,
+                           QString *error);
+};
+
+}  // namespace optgui
+
+#endif  // CONFIG_READER_H_
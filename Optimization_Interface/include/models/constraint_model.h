@@ -12,15 +12,23 @@
 #include <QVector>
 #include <QPointF>
 #include <QMutex>
+#include <QWaitCondition>
+#include <QAtomicInteger>
 #include <QTableWidget>
 
+#include <memory>
+
 #include "cprs.h"
 #include "algorithm.h"
 #include "autogen/lib.h"
 
 #include "include/globals.h"
+#include "include/models/data_model.h"
+#include "include/models/constraint_snapshot.h"
 #include "include/models/point_model_item.h"
 #include "include/models/ellipse_model_item.h"
+#include "include/models/ellipse_store.h"
+#include "include/models/obstacle_index.h"
 #include "include/models/cylinder_model_item.h"
 #include "include/models/polygon_model_item.h"
 #include "include/models/plane_model_item.h"
@@ -29,7 +37,7 @@
 
 namespace optgui {
 
-class ConstraintModel {
+class ConstraintModel : public DataModelListener {
  public:
     ConstraintModel();
     ~ConstraintModel();
@@ -71,12 +79,12 @@ class ConstraintModel {
 
     void setPathStagedModel(PathModelItem *model);
     void setPathStagedPoints(QVector<QPointF> points);
-    // remove first point from staged traj, return whether
-    // traj still has points
-    bool tickPathStaged();
+    // pass staged traj points before index, return whether
+    // index is still on traj
+    bool setPathStagedIndex(int index);
     // clear staged traj
     void clearPathStagedPoints();
-    // get copy of staged traj points
+    // get copy of staged traj points not yet passed
     QVector<QPointF> getPathStagedPoints();
 
     void addDrone(DroneModelItem *drone, PathModelItem *traj);
@@ -98,14 +106,17 @@ class ConstraintModel {
 
     // stage/unstage trajectory
     void stageTraj();
+    // stage given traj for drone instead of its current traj
+    void stageTraj(DroneModelItem *drone, TrajectoryFrame const &frame);
     void unstageTraj();
 
-    autogen::packet::traj2dof getCurrTraj2dof(DroneModelItem *drone);
-    void setCurrTraj2dof(DroneModelItem *drone,
-                         autogen::packet::traj2dof traj2dof_data);
+    // traj2dof of latest published solve for drone, GUI thread only.
+    // Solvers publish through the drone's path model
+    autogen::packet::traj2dof const &getCurrTraj2dof(
+            DroneModelItem *drone);
 
     // functions for staged traj network packet
-    autogen::packet::traj2dof getStagedTraj2dof();
+    autogen::packet::traj2dof const &getStagedTraj2dof();
     bool getIsTrajStaged();
     DroneModelItem *getStagedDrone();
 
@@ -127,15 +138,18 @@ class ConstraintModel {
     // (live reference)
     void setLiveReferenceMode(bool reference_mode);
     bool isLiveReference();
+    // receding horizon mode, staged drone keeps solving from its
+    // telemetry while its trajectory executes
+    void setMpcMode(bool mpc_mode);
+    bool isMpc();
+    // whether solves for drone are paused for a live reference
+    bool isSolvePaused(DroneModelItem *drone);
     void setFreeFinalTime(bool free_final_time);
     bool isFreeFinalTime();
 
     // functions for valid input detection
     INPUT_CODE getIsValidInput();
     bool setIsValidInput(INPUT_CODE code);
-    // calculate regions for ellipses to use for
-    // overlap detection
-    QVector<QRegion> getEllipseRegions();
     // mark overlapping ellipses as red
     void updateEllipseColors();
 
@@ -152,19 +166,48 @@ class ConstraintModel {
     bool isCurrDrone(DroneModelItem *drone);
     DroneModelItem *getCurrDrone();
 
-    // funtions for loading data into a skyenet params
-    void loadWaypointConstraints(skyenet::params *P,
-                                 double wp[skyenet::MAX_WAYPOINTS][3]);
-    void loadEllipseConstraints(skyenet::params *P);
-    void loadCylinderConstraints(skyenet::params *P);
-    void loadPosConstraints(skyenet::params *P);
+    // latest published snapshot of params with all constraints
+    // loaded, lock free
+    std::shared_ptr<ConstraintSnapshot const> getSnapshot();
+    // rebuild and publish snapshot if constraints changed since last
+    // publish and wake compute threads. Called by the GUI thread
+    // once per flush so solvers never take model_lock_ to rebuild
+    void publishSnapshot();
+
+    // functions for waking compute threads when the model changes
+    // wake all waiting threads
+    void notifyChange();
+    // get current change count, read before checking for work
+    quint64 getChangeCount();
+    // block until change count differs from seen or timeout,
+    // return whether a change occured
+    bool waitForChange(quint64 seen, unsigned long timeout_ms);
+
+    // get version of published snapshot of constraints and params
+    // shared by all drones, changes whenever a solve input other than
+    // drone or target changes and the change is published
+    quint64 getModelVersion();
+    // called by items on change, lock free
+    void dataModelChanged(bool is_constraint) override;
 
 private:
     QMutex model_lock_;
 
+    // change notification for compute threads, separate lock so
+    // waiting threads never hold model_lock_
+    QMutex change_lock_;
+    QWaitCondition change_cond_;
+    quint64 change_count_;
+    // aggregate version of constraints and params
+    QAtomicInteger<quint64> model_version_;
+    // latest published snapshot, only access with
+    // std::atomic_load and std::atomic_store
+    std::shared_ptr<ConstraintSnapshot const> snapshot_;
+    // version of snapshot_, stored after it
+    QAtomicInteger<quint64> published_version_;
+
     // skyenet params
     skyenet::params P_;
-    autogen::packet::traj2dof drone_staged_traj2dof_data_;
 
     // input and feasibility status
     INPUT_CODE input_code_;
@@ -174,6 +217,7 @@ private:
     bool traj_staged_;
     // flag for tracking a sent trajectory
     bool is_live_reference_;
+    bool is_mpc_;
     bool is_free_final_time_;
 
     // Clearance around ellipses in meters
@@ -182,6 +226,10 @@ private:
     // Constraints
     QVector<EllipseModelItem *> ellipses_;
     QVector<CylinderModelItem *> cylinders_;
+    // ellipse geometry for solver, same order as ellipses_
+    EllipseStore ellipse_store_;
+    // broad phase grid for obstacle overlap detection
+    ObstacleIndex obstacle_index_;
     QSet<PolygonModelItem *> polygons_;
     QSet<PlaneModelItem *> planes_;
 
@@ -189,12 +237,21 @@ private:
     QVector<PointModelItem *> waypoints_;
     PathModelItem *path_staged_;
     DroneModelItem *staged_drone_;
-    QMap<DroneModelItem *, QPair<PathModelItem *,
-                                 autogen::packet::traj2dof>> drones_;
+    QMap<DroneModelItem *, PathModelItem *> drones_;
     QSet<PointModelItem *> final_points_;
     DroneModelItem *curr_drone_;
 
+    // increment model version, published on next flush
+    void bumpModelVersion();
+    // reload changed obstacles into overlap index
+    void updateObstacleIndex();
+
     // Convert constraints to skyefly params
+    void loadWaypointConstraints(skyenet::params *P,
+                                 double wp[skyenet::MAX_WAYPOINTS][3]);
+    void loadEllipseConstraints(skyenet::params *P);
+    void loadCylinderConstraints(skyenet::params *P);
+    void loadPosConstraints(skyenet::params *P);
     void loadPlaneConstraint(skyenet::params *P, quint32 index,
                                  QVector3D p, QVector3D q);
     int distributeWpEvenly(skyenet::params *P, int index, int remaining,
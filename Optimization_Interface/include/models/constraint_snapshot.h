@@ -0,0 +1,42 @@
+// TITLE:   Optimization_Interface/include/models/constraint_snapshot.h
+// AUTHORS: Daniel Sullivan
+// LAB:     Autonomous Controls Lab (ACL)
+// LICENSE: Copyright 2020, All Rights Reserved
+
+// Immutable copy of all constraints and params for one model version
+
+#ifndef CONSTRAINT_SNAPSHOT_H_
+#define CONSTRAINT_SNAPSHOT_H_
+
+#include <QtGlobal>
+
+#include "cprs.h"
+#include "algorithm.h"
+
+namespace optgui {
+
+// Built by ConstraintModel under the model lock, never modified after
+// being published so compute threads can read it without locking
+struct ConstraintSnapshot {
+    // model version this snapshot was built from
+    quint64 version;
+
+    // params with ellipse, cylinder, position and waypoint
+    // constraints already loaded
+    skyenet::params P;
+
+    // waypoint positions in meters
+    double wp[skyenet::MAX_WAYPOINTS][3];
+    // identifies the ordered set of waypoint items, not positions
+    quint64 waypoint_key;
+
+    // solve settings
+    bool is_free_final_time;
+
+    // whether any ellipse overlaps another obstacle
+    bool is_obs_overlap;
+};
+
+}  // namespace optgui
+
+#endif  // CONSTRAINT_SNAPSHOT_H_
@@ -59,11 +59,13 @@ class CylinderModelItem : public DataModel {
         this->width_ = width;
         // update region
         this->region_ = this->generateRegion();
+        this->bumpGeneration();
     }
 
     void setTriggerWidth(qreal trigger_width) {
         QMutexLocker locker(&this->mutex_);
         this->trigger_width_ = std::max(0.0,trigger_width);
+        this->bumpGeneration();
     }
     qreal getHeight() {
         QMutexLocker locker(&this->mutex_);
@@ -76,6 +78,7 @@ class CylinderModelItem : public DataModel {
         this->height_ = height;
         // update region
         this->region_ = this->generateRegion();
+        this->bumpGeneration();
     }
 
     qreal getRot() {
@@ -89,6 +92,7 @@ class CylinderModelItem : public DataModel {
         this->rot_ = rot;
         // update region
         this->region_ = this->generateRegion();
+        this->bumpGeneration();
     }
 
     QPointF getPos() {
@@ -103,6 +107,7 @@ class CylinderModelItem : public DataModel {
         this->pos_.setY(pos.y());
         // update region
         this->region_ = this->generateRegion();
+        this->bumpGeneration();
     }
 
     bool getDirection() {
@@ -116,6 +121,7 @@ class CylinderModelItem : public DataModel {
         QMutexLocker locker(&this->mutex_);
         // flip direction of constraint inequality
         this->direction_ = !this->direction_;
+        this->bumpGeneration();
     }
 
     qreal getClearance() {
@@ -129,6 +135,7 @@ class CylinderModelItem : public DataModel {
         this->clearance_ = clearance;
         // update region
         this->region_ = this->generateRegion();
+        this->bumpGeneration();
     }
 
     bool getIsOverlap() {
@@ -9,17 +9,57 @@
 #define DATA_MODEL_H_
 
 #include <QtMath>
+#include <QAtomicInteger>
+#include <QAtomicPointer>
 
 namespace optgui {
 
+// Interface for objects notified when a data model changes.
+// Called from inside item setters while the item lock is held,
+// implementations must not lock other models
+class DataModelListener {
+ public:
+    virtual ~DataModelListener() {}
+    virtual void dataModelChanged(bool is_constraint) = 0;
+};
+
 class DataModel {
  public:
     // default initialize port to 0
-    DataModel() : port_(0) {}
+    DataModel() : port_(0), generation_(0), listener_(nullptr),
+        is_constraint_(0) {}
     virtual ~DataModel() {}
 
     // network port
     quint16 port_;
+
+    // get number of times item data has changed
+    quint64 getGeneration() {
+        return this->generation_.load();
+    }
+
+    // set listener to notify on change, nullptr to clear.
+    // is_constraint marks whether changes affect every trajectory
+    void setListener(DataModelListener *listener, bool is_constraint) {
+        this->is_constraint_.store(is_constraint ? 1 : 0);
+        this->listener_.store(listener);
+    }
+
+ protected:
+    // call from setters after item data changes
+    void bumpGeneration() {
+        this->generation_++;
+        DataModelListener *listener = this->listener_.load();
+        if (listener) {
+            listener->dataModelChanged(this->is_constraint_.load() != 0);
+        }
+    }
+
+ private:
+    // lock free so compute threads can poll without blocking setters
+    QAtomicInteger<quint64> generation_;
+    QAtomicPointer<DataModelListener> listener_;
+    QAtomicInt is_constraint_;
 };
 
 }  // namespace optgui
@@ -12,6 +12,9 @@
 #include <QVector3D>
 #include <QString>
 #include <QMutex>
+#include <QAtomicInteger>
+
+#include <atomic>
 
 #include "include/models/data_model.h"
 
@@ -19,13 +22,33 @@
 
 namespace optgui {
 
+// One telemetry sample in gui xyz pixels
+struct DroneState {
+    QVector3D pos;
+    QVector3D vel;
+    QVector3D accel;
+    // measurement time on getMonotonicUsec clock
+    qint64 time_usec;
+};
+
+// State samples are kept in a short ring. Each slot is a seqlock so
+// readers on any thread get one whole sample without blocking the
+// network thread, writers are serialized by a mutex
 class DroneModelItem : public DataModel {
  public:
-    explicit DroneModelItem(QPointF const &pos) : mutex_() {
-        this->pos_ = QVector3D(pos.x(), pos.y(), 0);
-        this->vel_ = QVector3D(0, 0, 0);
+    explicit DroneModelItem(QPointF const &pos) : write_mutex_() {
+        DroneState state;
+        state.pos = QVector3D(pos.x(), pos.y(), 0);
+        state.vel = QVector3D(0, 0, 0);
         // counteract gravity
-        this->accel_ = QVector3D(0, 0, 9.81 * GRID_SIZE);
+        state.accel = QVector3D(0, 0, 9.81 * GRID_SIZE);
+        state.time_usec = getMonotonicUsec();
+        // fill history so every age is valid
+        for (Slot &slot : this->history_) {
+            slot.sequence = 0;
+            slot.state = state;
+        }
+        this->latest_ = 0;
         port_ = 0;
         destination_port_ = 6000;
         ip_addr_ = "0.0.0.0";
@@ -33,40 +56,79 @@ class DroneModelItem : public DataModel {
 
     ~DroneModelItem() {
         // acquire lock to destroy it
-        QMutexLocker locker(&this->mutex_);
+        QMutexLocker locker(&this->write_mutex_);
+    }
+
+    // sample age samples before latest, age below HISTORY_SIZE
+    DroneState getState(int age = 0) const {
+        int index = this->latest_.loadAcquire() - age;
+        return this->readSlot((index + HISTORY_SIZE) % HISTORY_SIZE);
+    }
+
+    // latest sample extrapolated to time_usec with constant
+    // acceleration, never backwards or past MAX_PREDICT_USEC
+    DroneState predictState(qint64 time_usec) const {
+        DroneState state = this->getState();
+        qint64 dt_usec = qBound<qint64>(0, time_usec - state.time_usec,
+                                        MAX_PREDICT_USEC);
+        qreal dt = dt_usec / 1.0e6;
+        // planar only, vertical accel holds gravity compensation
+        QVector3D accel(state.accel.x(), state.accel.y(), 0);
+        state.pos += (state.vel * dt) + (accel * (0.5 * dt * dt));
+        state.vel += accel * dt;
+        state.time_usec += dt_usec;
+        return state;
+    }
+
+    // store one telemetry sample measured at time_usec
+    void setState(QVector3D pos, QVector3D vel, QVector3D accel,
+                  qint64 time_usec) {
+        QMutexLocker locker(&this->write_mutex_);
+        DroneState state;
+        state.pos = pos;
+        state.vel = vel;
+        state.accel = accel;
+        state.time_usec = time_usec;
+        this->writeState(state);
     }
 
     QVector3D getPos() {
-        QMutexLocker locker(&this->mutex_);
         // get copy of pos
-        return this->pos_;
+        return this->getState().pos;
     }
 
     void setPos(QVector3D pos) {
-        QMutexLocker locker(&this->mutex_);
-        this->pos_ = pos;
+        QMutexLocker locker(&this->write_mutex_);
+        DroneState state = this->getState();
+        state.pos = pos;
+        state.time_usec = getMonotonicUsec();
+        this->writeState(state);
     }
 
     QVector3D getVel() {
-        QMutexLocker locker(&this->mutex_);
         // get copy of velocity
-        return this->vel_;
+        return this->getState().vel;
     }
 
     void setVel(QVector3D vel) {
-        QMutexLocker locker(&this->mutex_);
-        this->vel_ = vel;
+        QMutexLocker locker(&this->write_mutex_);
+        DroneState state = this->getState();
+        state.vel = vel;
+        state.time_usec = getMonotonicUsec();
+        this->writeState(state);
     }
 
     QVector3D getAccel() {
-        QMutexLocker locker(&this->mutex_);
         // get copy of acceleration
-        return this->accel_;
+        return this->getState().accel;
     }
 
     void setAccel(QVector3D accel) {
-        QMutexLocker locker(&this->mutex_);
-        this->accel_ = accel;
+        QMutexLocker locker(&this->write_mutex_);
+        DroneState state = this->getState();
+        state.accel = accel;
+        state.time_usec = getMonotonicUsec();
+        this->writeState(state);
     }
 
     // IP addr of drone
@@ -74,12 +136,52 @@ class DroneModelItem : public DataModel {
     // listening port on drone
     quint16 destination_port_;
 
+    // number of samples kept
+    static const int HISTORY_SIZE = 8;
+    // max extrapolation, older samples are treated as stale
+    static const qint64 MAX_PREDICT_USEC = 200000;
+
  private:
-    // mutex lock for getters/setters
-    QMutex mutex_;
-    QVector3D pos_;
-    QVector3D vel_;
-    QVector3D accel_;
+    struct Slot {
+        // odd while slot is being written
+        QAtomicInteger<quint32> sequence;
+        DroneState state;
+    };
+
+    // serializes writers only, readers never lock
+    QMutex write_mutex_;
+    Slot history_[HISTORY_SIZE];
+    // index of newest complete slot
+    QAtomicInt latest_;
+
+    // write state to slot after latest, caller holds write lock
+    void writeState(DroneState const &state) {
+        int index = (this->latest_.loadAcquire() + 1) % HISTORY_SIZE;
+        Slot &slot = this->history_[index];
+        quint32 sequence = slot.sequence.load();
+        slot.sequence.store(sequence + 1);
+        std::atomic_thread_fence(std::memory_order_release);
+        slot.state = state;
+        slot.sequence.storeRelease(sequence + 2);
+        this->latest_.storeRelease(index);
+        this->bumpGeneration();
+    }
+
+    // copy of slot, retried if a writer overlapped the copy
+    DroneState readSlot(int index) const {
+        Slot const &slot = this->history_[index];
+        forever {
+            quint32 sequence = slot.sequence.loadAcquire();
+            if (sequence & 1) {
+                continue;
+            }
+            DroneState state = slot.state;
+            std::atomic_thread_fence(std::memory_order_acquire);
+            if (slot.sequence.load() == sequence) {
+                return state;
+            }
+        }
+    }
 };
 
 }  // namespace optgui
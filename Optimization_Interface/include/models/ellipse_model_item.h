@@ -10,8 +10,8 @@
 
 #include <QPointF>
 #include <QMutex>
-#include <QRegion>
-#include <QTransform>
+#include <QVector3D>
+#include <QtMath>
 
 #include "include/models/data_model.h"
 #include "include/globals.h"
@@ -20,6 +20,25 @@ namespace optgui {
 
 qreal const DEFAULT_RAD = 100;
 
+// ellipse geometry in meters, in the form loaded into the solver
+struct EllipseShape {
+    // center
+    double c_x;
+    double c_y;
+    // semi axes including clearance
+    double a;
+    double b;
+    // rotation in radians
+    double rot;
+    // clearance
+    double clearance;
+    // shape matrix rows, M0 = [m00 m01], M1 = [m10 m11]
+    double m00;
+    double m01;
+    double m10;
+    double m11;
+};
+
 class EllipseModelItem : public DataModel {
  public:
     explicit EllipseModelItem(QPointF pos, qreal clearance,
@@ -29,9 +48,9 @@ class EllipseModelItem : public DataModel {
         direction_(false), is_overlap_(false), clearance_(clearance) {
         // set pos from param
         this->pos_ = pos;
-        // generate region for overlap detection,
-        // only generate new region when coords change
-        this->region_ = generateRegion();
+        // precompute solver geometry, used for solver params
+        // and overlap detection
+        this->shape_ = this->generateShape();
     }
 
     ~EllipseModelItem() {
@@ -48,8 +67,9 @@ class EllipseModelItem : public DataModel {
     void setWidth(qreal width) {
         QMutexLocker locker(&this->mutex_);
         this->width_ = width;
-        // update region
-        this->region_ = this->generateRegion();
+        // update geometry
+        this->shape_ = this->generateShape();
+        this->bumpGeneration();
     }
 
     qreal getHeight() {
@@ -61,8 +81,9 @@ class EllipseModelItem : public DataModel {
     void setHeight(qreal height) {
         QMutexLocker locker(&this->mutex_);
         this->height_ = height;
-        // update region
-        this->region_ = this->generateRegion();
+        // update geometry
+        this->shape_ = this->generateShape();
+        this->bumpGeneration();
     }
 
     qreal getRot() {
@@ -74,8 +95,9 @@ class EllipseModelItem : public DataModel {
     void setRot(qreal rot) {
         QMutexLocker locker(&this->mutex_);
         this->rot_ = rot;
-        // update region
-        this->region_ = this->generateRegion();
+        // update geometry
+        this->shape_ = this->generateShape();
+        this->bumpGeneration();
     }
 
     QPointF getPos() {
@@ -88,8 +110,9 @@ class EllipseModelItem : public DataModel {
         QMutexLocker locker(&this->mutex_);
         this->pos_.setX(pos.x());
         this->pos_.setY(pos.y());
-        // update region
-        this->region_ = this->generateRegion();
+        // update geometry
+        this->shape_ = this->generateShape();
+        this->bumpGeneration();
     }
 
     bool getDirection() {
@@ -103,6 +126,7 @@ class EllipseModelItem : public DataModel {
         QMutexLocker locker(&this->mutex_);
         // flip direction of constraint inequality
         this->direction_ = !this->direction_;
+        this->bumpGeneration();
     }
 
     qreal getClearance() {
@@ -114,8 +138,9 @@ class EllipseModelItem : public DataModel {
     void setClearance(qreal clearance) {
         QMutexLocker locker(&this->mutex_);
         this->clearance_ = clearance;
-        // update region
-        this->region_ = this->generateRegion();
+        // update geometry
+        this->shape_ = this->generateShape();
+        this->bumpGeneration();
     }
 
     bool getIsOverlap() {
@@ -128,9 +153,10 @@ class EllipseModelItem : public DataModel {
         this->is_overlap_ = is_overlap;
     }
 
-    QRegion const getRegion() {
+    EllipseShape getShape() {
         QMutexLocker locker(&this->mutex_);
-        return this->region_;
+        // get copy of precomputed geometry in meters
+        return this->shape_;
     }
 
  private:
@@ -149,23 +175,35 @@ class EllipseModelItem : public DataModel {
     bool is_overlap_;
     // clearance in meters
     qreal clearance_;
-    // save region for detecting overlap to minimize
-    // times needed to generate
-    QRegion region_;
-
-    QRegion generateRegion() {
-        // create a QRegion to use for overlap detection
-        qreal width = this->width_ + (this->clearance_ * GRID_SIZE);
-        qreal height = this->height_ + (this->clearance_ * GRID_SIZE);
-        QRegion region = QRegion(QRect(-width, -height,
-                                       width * 2, height * 2),
-                                 QRegion::Ellipse);
-        QTransform rotation;
-        rotation.rotate(this->rot_);
-        region = rotation.map(region);
-        region.translate(this->pos_.x(), this->pos_.y());
-
-        return region;
+    // save solver geometry so matrices are only computed
+    // when coords change
+    EllipseShape shape_;
+
+    EllipseShape generateShape() {
+        EllipseShape shape;
+
+        QVector3D xyz_coords = guiXyzToXyz(this->pos_.x(),
+                                           this->pos_.y(), 0);
+        shape.c_x = xyz_coords.x();
+        shape.c_y = xyz_coords.y();
+
+        shape.clearance = this->clearance_;
+        shape.a = (this->height_ / GRID_SIZE) + this->clearance_;
+        shape.b = (this->width_ / GRID_SIZE) + this->clearance_;
+        shape.rot = qDegreesToRadians(this->rot_);
+
+        // calculate ellipse matrix in meters
+        qreal inv_a = 1.0 / shape.a;
+        qreal inv_b = 1.0 / shape.b;
+        qreal sin_t = qSin(shape.rot);
+        qreal cos_t = qCos(shape.rot);
+
+        shape.m00 = (inv_a * cos_t * cos_t) + (inv_b * sin_t * sin_t);
+        shape.m01 = (inv_a - inv_b) * sin_t * cos_t;
+        shape.m10 = shape.m01;
+        shape.m11 = (inv_a * sin_t * sin_t) + (inv_b * cos_t * cos_t);
+
+        return shape;
     }
 };
 
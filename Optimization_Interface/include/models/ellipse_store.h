@@ -0,0 +1,127 @@
+// TITLE:   Optimization_Interface/include/models/ellipse_store.h
+// AUTHORS: Daniel Sullivan
+// LAB:     Autonomous Controls Lab (ACL)
+// LICENSE: Copyright 2020, All Rights Reserved
+
+// Struct of arrays copy of ellipse geometry for loading solver params
+
+#ifndef ELLIPSE_STORE_H_
+#define ELLIPSE_STORE_H_
+
+#include <QVector>
+
+#include "cprs.h"
+#include "algorithm.h"
+
+#include "include/models/ellipse_model_item.h"
+
+namespace optgui {
+
+// Rows are kept in the same order as the model's ellipse list.
+// Not locked, owner must serialize access
+class EllipseStore {
+ public:
+    EllipseStore() {}
+
+    int size() const {
+        return this->generation_.size();
+    }
+
+    // add empty row, filled on next refresh
+    void append() {
+        this->c_x_.append(0);
+        this->c_y_.append(0);
+        this->a_.append(0);
+        this->b_.append(0);
+        this->rot_.append(0);
+        this->clearance_.append(0);
+        this->m00_.append(0);
+        this->m01_.append(0);
+        this->m10_.append(0);
+        this->m11_.append(0);
+        this->generation_.append(INVALID_GENERATION);
+    }
+
+    void remove(int index) {
+        this->c_x_.remove(index);
+        this->c_y_.remove(index);
+        this->a_.remove(index);
+        this->b_.remove(index);
+        this->rot_.remove(index);
+        this->clearance_.remove(index);
+        this->m00_.remove(index);
+        this->m01_.remove(index);
+        this->m10_.remove(index);
+        this->m11_.remove(index);
+        this->generation_.remove(index);
+    }
+
+    // generation of item the row was copied from
+    quint64 getGeneration(int index) const {
+        return this->generation_.at(index);
+    }
+
+    void set(int index, EllipseShape const &shape, quint64 generation) {
+        this->c_x_[index] = shape.c_x;
+        this->c_y_[index] = shape.c_y;
+        this->a_[index] = shape.a;
+        this->b_[index] = shape.b;
+        this->rot_[index] = shape.rot;
+        this->clearance_[index] = shape.clearance;
+        this->m00_[index] = shape.m00;
+        this->m01_[index] = shape.m01;
+        this->m10_[index] = shape.m10;
+        this->m11_[index] = shape.m11;
+        this->generation_[index] = generation;
+    }
+
+    // copy centers and matrices into solver obstacle params
+    void fill(skyenet::params *P) const {
+        int n = qMin(this->size(), static_cast<int>(skyenet::MAX_OBS));
+
+        // raw pointers so loop has no bounds checks or detach
+        // and can be vectorized
+        double const *c_x = this->c_x_.constData();
+        double const *c_y = this->c_y_.constData();
+        double const *m00 = this->m00_.constData();
+        double const *m01 = this->m01_.constData();
+        double const *m10 = this->m10_.constData();
+        double const *m11 = this->m11_.constData();
+
+        for (int i = 0; i < n; i++) {
+            P->obs.R[i] = 1;
+            P->obs.M0[0][i] = m00[i];
+            P->obs.M0[1][i] = m01[i];
+            P->obs.M1[0][i] = m10[i];
+            P->obs.M1[1][i] = m11[i];
+            P->obs.c_x[i] = c_x[i];
+            P->obs.c_y[i] = c_y[i];
+        }
+        P->obs.n = n;
+    }
+
+ private:
+    static const quint64 INVALID_GENERATION = ~0ULL;
+
+    // centers in meters
+    QVector<double> c_x_;
+    QVector<double> c_y_;
+    // semi axes in meters including clearance
+    QVector<double> a_;
+    QVector<double> b_;
+    // rotation in radians
+    QVector<double> rot_;
+    // clearance in meters
+    QVector<double> clearance_;
+    // shape matrices
+    QVector<double> m00_;
+    QVector<double> m01_;
+    QVector<double> m10_;
+    QVector<double> m11_;
+    // item generation each row was copied from
+    QVector<quint64> generation_;
+};
+
+}  // namespace optgui
+
+#endif  // ELLIPSE_STORE_H_
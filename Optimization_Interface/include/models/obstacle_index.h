@@ -0,0 +1,103 @@
+// TITLE:   Optimization_Interface/include/models/obstacle_index.h
+// AUTHORS: Daniel Sullivan
+// LAB:     Autonomous Controls Lab (ACL)
+// LICENSE: Copyright 2020, All Rights Reserved
+
+// Uniform grid over ellipse and cylinder bounds for overlap detection
+
+#ifndef OBSTACLE_INDEX_H_
+#define OBSTACLE_INDEX_H_
+
+#include <QHash>
+#include <QVector>
+
+#include "include/models/ellipse_model_item.h"
+#include "include/models/cylinder_model_item.h"
+
+namespace optgui {
+
+// Not locked, owner must serialize access
+class ObstacleIndex {
+ public:
+    ObstacleIndex();
+
+    // add and remove obstacles, geometry is loaded on next update
+    void addEllipse(EllipseModelItem *item);
+    void addCylinder(CylinderModelItem *item);
+    void remove(DataModel *item);
+
+    // reload geometry and grid cells if item changed since last update
+    void updateEllipse(EllipseModelItem *item);
+    void updateCylinder(CylinderModelItem *item);
+
+    // whether any ellipse overlaps another ellipse or a cylinder,
+    // cached until an obstacle changes
+    bool hasOverlap();
+    // same result testing every pair without the grid or cache,
+    // baseline for benchmarks
+    bool hasOverlapAllPairs();
+
+ private:
+    enum ENTRY_TYPE {
+        ELLIPSE_ENTRY,
+        CYLINDER_ENTRY
+    };
+
+    struct Entry {
+        ENTRY_TYPE type;
+        // item generation geometry was loaded from
+        quint64 generation;
+        // center in meters
+        double c_x;
+        double c_y;
+        // ellipse shape matrix
+        double m00;
+        double m01;
+        double m10;
+        double m11;
+        // cylinder corners in meters
+        double corners[4][2];
+        // axis aligned bounds in meters
+        double min_x;
+        double min_y;
+        double max_x;
+        double max_y;
+        // range of grid cells covered
+        int cell_x0;
+        int cell_y0;
+        int cell_x1;
+        int cell_y1;
+        bool is_binned;
+    };
+
+    static const quint64 INVALID_GENERATION = ~0ULL;
+    // grid cell size in meters
+    static constexpr double CELL_SIZE = 2.0;
+
+    // entries by slot, removed slots are reused
+    QVector<Entry> entries_;
+    QVector<int> free_slots_;
+    QHash<DataModel *, int> slots_;
+    // grid cell key to slots of entries touching cell
+    QHash<quint64, QVector<int>> cells_;
+
+    bool is_dirty_;
+    bool is_overlap_;
+
+    int addEntry(DataModel *item, ENTRY_TYPE type);
+    void bin(int slot);
+    void unbin(int slot);
+    static quint64 cellKey(int x, int y);
+
+    // exact narrow phase tests in meters
+    bool isOverlap(Entry const &a, Entry const &b);
+    static bool isEllipseEllipseOverlap(Entry const &a, Entry const &b);
+    static bool isEllipseBoxOverlap(Entry const &ellipse, Entry const &box);
+    // distance from point to axis aligned ellipse with e0 >= e1
+    static double distancePointEllipse(double e0, double e1,
+                                       double y0, double y1);
+};
+
+}  // namespace optgui
+
+#endif  // OBSTACLE_INDEX_H_
@@ -10,85 +10,179 @@
 
 #include <QPointF>
 #include <QVector>
-#include <QMutex>
+#include <QAtomicInt>
+
+#include "autogen/lib.h"
 
 #include "include/models/data_model.h"
 
 namespace optgui {
 
+// GUI points and mikipilot packet of one solve
+struct TrajectoryFrame {
+    QVector<QPointF> points;
+    autogen::packet::traj2dof traj2dof;
+    // feasibility of this solve, global flag may be from another drone
+    bool is_feasible = false;
+};
+
+// Trajectory handed from one solving thread to the GUI thread without
+// copies or locks. The solver fills the back frame in place and
+// publishes it by swapping indices with the pending frame, the GUI
+// thread swaps a published frame into the front. Three preallocated
+// frames so the front stays stable while the back is written.
+// Point setters and getters are GUI thread only and act on the front.
+// Points before start are passed and not drawn, start is reset when
+// points are replaced
 class PathModelItem : public DataModel {
  public:
-    PathModelItem() : DataModel(), mutex_() {
+    PathModelItem() : DataModel(), pending_(1) {
+        this->back_ = 0;
+        this->front_ = 2;
+        this->front_version_ = 0;
+        this->start_ = 0;
+        // solver horizon rarely exceeds this, grows if needed
+        for (TrajectoryFrame &frame : this->frames_) {
+            frame.points.reserve(INITIAL_CAPACITY);
+        }
+    }
+
+    // ====== Solving thread ======
+
+    // frame to fill for next publish, reused so keeps capacity
+    TrajectoryFrame *getBackFrame() {
+        return &this->frames_[this->back_];
+    }
+
+    // make back frame the latest, back becomes an unshown frame
+    void publishFrame() {
+        this->back_ = this->pending_.fetchAndStoreAcquireRelease(
+                    this->back_ | FRESH) & INDEX_MASK;
+    }
+
+    // ====== GUI thread ======
+
+    // latest published frame, stable until next call
+    TrajectoryFrame const &getFrame() {
+        this->latchFrame();
+        return this->frames_[this->front_];
     }
 
-    ~PathModelItem() {
-        // acquire lock to destroy it
-        QMutexLocker locker(&this->mutex_);
+    // front frame without taking a newer one, so painting matches
+    // the area last given to the scene index
+    TrajectoryFrame const &peekFrame() const {
+        return this->frames_[this->front_];
+    }
+
+    // number of times front frame changed, to cache derived data
+    quint64 getVersion() {
+        this->latchFrame();
+        return this->front_version_;
     }
 
     quint32 getSize() {
-        QMutexLocker locker(&this->mutex_);
         // get number of points in traj
-        return this->points_.size();
+        return this->getFrame().points.size();
     }
 
     void setPointAt(QPointF point, int index) {
-        QMutexLocker locker(&this->mutex_);
+        QVector<QPointF> &points = this->getFront()->points;
         // set point in traj if within bounds
-        if (index < this->points_.size()) {
-            QPointF &temp = this->points_[index];
-            temp.setX(point.x());
-            temp.setY(point.y());
+        if (index < points.size()) {
+            points[index] = point;
         }
     }
 
     QPointF getPointAt(int index) {
-        QMutexLocker locker(&this->mutex_);
+        QVector<QPointF> const &points = this->getFrame().points;
         // get point in traj if within bounds,
         // return default point if out of bounds
-        if (index < this->points_.size()) {
-            return this->points_.value(index);
+        if (index < points.size()) {
+            return points.at(index);
         } else {
             return QPointF();
         }
     }
 
-    void setPoints(QVector<QPointF> points) {
-        QMutexLocker locker(&this->mutex_);
+    void setPoints(QVector<QPointF> const &points) {
         // copy over points
-        this->points_ = points;
+        this->getFront()->points = points;
+        this->start_ = 0;
+    }
+
+    // copy frame into front, used to stage a trajectory
+    void setFrame(TrajectoryFrame const &frame) {
+        *this->getFront() = frame;
+        this->start_ = 0;
+    }
+
+    // first point not yet passed
+    int getStart() const {
+        return this->start_;
+    }
+
+    // pass points before start without moving the rest
+    void setStart(int start) {
+        this->latchFrame();
+        this->start_ = start;
+        this->front_version_++;
     }
 
     void addPoint(QPointF point) {
-        QMutexLocker locker(&this->mutex_);
         // append point to traj
-        this->points_.append(point);
+        this->getFront()->points.append(point);
     }
 
     void removePointAt(int index) {
-        QMutexLocker locker(&this->mutex_);
+        QVector<QPointF> &points = this->getFront()->points;
         // remove point from traj if within bounds
-        if (index < this->points_.size()) {
-            this->points_.removeAt(index);
+        if (index < points.size()) {
+            points.removeAt(index);
         }
     }
 
     void clearPoints() {
-        QMutexLocker locker(&this->mutex_);
-        this->points_.clear();
+        this->getFront()->points.resize(0);
+        this->start_ = 0;
     }
 
     QVector<QPointF> getPoints() {
-        QMutexLocker locker(&this->mutex_);
-        // get copy of points
-        return this->points_;
+        // get shallow copy of points
+        return this->getFrame().points;
     }
 
  private:
-    // mutex lock for getters/setters
-    QMutex mutex_;
-    // point in trajectory
-    QVector<QPointF> points_;
+    static const int INITIAL_CAPACITY = 64;
+    // pending index is flagged fresh until GUI thread takes it
+    static const int FRESH = 0x4;
+    static const int INDEX_MASK = 0x3;
+
+    TrajectoryFrame frames_[3];
+    // owned by solving thread
+    int back_;
+    // owned by GUI thread
+    int front_;
+    quint64 front_version_;
+    int start_;
+    // last published or last shown frame, shared
+    QAtomicInt pending_;
+
+    // swap in latest published frame if any
+    void latchFrame() {
+        if (this->pending_.loadAcquire() & FRESH) {
+            this->front_ = this->pending_.fetchAndStoreAcquireRelease(
+                        this->front_) & INDEX_MASK;
+            this->front_version_++;
+        }
+    }
+
+    // front for GUI edits, takes any published frame first so
+    // the edit is not hidden by an older solve
+    TrajectoryFrame *getFront() {
+        this->latchFrame();
+        this->front_version_++;
+        return &this->frames_[this->front_];
+    }
 };
 
 }  // namespace optgui
@@ -40,6 +40,7 @@ class PlaneModelItem : public DataModel {
         // set first point in xyz pixels
         this->p1_.setX(pos.x());
         this->p1_.setY(pos.y());
+        this->bumpGeneration();
     }
 
     QPointF getP2() {
@@ -53,6 +54,7 @@ class PlaneModelItem : public DataModel {
         // get copy of second point in xyz pixels
         this->p2_.setX(pos.x());
         this->p2_.setY(pos.y());
+        this->bumpGeneration();
     }
 
     bool getDirection() {
@@ -65,6 +67,7 @@ class PlaneModelItem : public DataModel {
         QMutexLocker locker(&this->mutex_);
         // flip direction of constraint
         this->direction_ = !this->direction_;
+        this->bumpGeneration();
     }
 
  private:
@@ -37,6 +37,7 @@ class PointModelItem : public DataModel {
         QMutexLocker locker(&this->mutex_);
         this->pos_.setX(pos.x());
         this->pos_.setY(pos.y());
+        this->bumpGeneration();
     }
 
  private:
@@ -41,6 +41,7 @@ class PolygonModelItem : public DataModel {
         QPointF &temp = this->points_[index];
         temp.setX(point.x());
         temp.setY(point.y());
+        this->bumpGeneration();
     }
 
     QPointF getPointAt(quint32 index) {
@@ -59,6 +60,7 @@ class PolygonModelItem : public DataModel {
         QMutexLocker locker(&this->mutex_);
         // flip direction of constraint inequality
         this->direction_ = !this->direction_;
+        this->bumpGeneration();
     }
 
     bool isConvex() {
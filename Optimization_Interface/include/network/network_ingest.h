@@ -0,0 +1,163 @@
+// TITLE:   Optimization_Interface/include/network/network_ingest.h
+// AUTHORS: Daniel Sullivan
+// LAB:     Autonomous Controls Lab (ACL)
+// LICENSE: Copyright 2020, All Rights Reserved
+
+// Receives telemetry for all network items on one thread
+
+#ifndef NETWORK_INGEST_H_
+#define NETWORK_INGEST_H_
+
+#include <QThread>
+#include <QMutex>
+#include <QHash>
+#include <QVector>
+#include <QByteArray>
+#include <QVector3D>
+#include <QAtomicInteger>
+#include <QElapsedTimer>
+
+#include "include/graphics/drone_graphics_item.h"
+#include "include/graphics/ellipse_graphics_item.h"
+#include "include/graphics/cylinder_graphics_item.h"
+#include "include/graphics/repaint_coalescer.h"
+#include "include/models/point_model_item.h"
+#include "include/network/session_recorder.h"
+
+namespace optgui {
+
+// Telemetry still arrives on one port per item since packets carry
+// no item id, but every port is polled by this thread. Each wakeup
+// drains ready sockets in batches, decodes only the newest datagram
+// per item and applies it to the model once. Graphics moves are
+// collected for the GUI thread to hand to the repaint coalescer.
+// Routes are set while stopped, items may be removed while running
+class NetworkIngest : public QThread {
+    Q_OBJECT
+
+ public:
+    explicit NetworkIngest(QObject *parent = nullptr);
+    ~NetworkIngest();
+
+    // route telemetry on item port to item, call while stopped
+    void addDrone(DroneGraphicsItem *item);
+    void addPoint(QGraphicsItem *item, PointModelItem *model);
+    void addEllipse(EllipseGraphicsItem *item);
+    void addCylinder(CylinderGraphicsItem *item);
+    void clearRoutes();
+
+    // stop routing to item, blocks while its update is applied so
+    // item can be deleted after return
+    void removeItem(QGraphicsItem *item);
+
+    // bind route ports and start receive loop
+    void startIngest();
+    // flag loop to stop, run returns within one poll timeout
+    void stopIngest();
+
+    // record every received datagram, call while stopped
+    void setRecorder(SessionRecorder *recorder);
+    // replay thread, decode newest valid of datagrams drained in one
+    // wakeup and apply it as if received on port, routes must not be
+    // cleared while injecting
+    void injectDatagrams(quint16 port, QVector<QByteArray> const &datagrams);
+
+    // GUI thread, post moves received since last call
+    void takeMoves(RepaintCoalescer *coalescer);
+    // packet rate, batching and errors since last call
+    QString takeStatsText();
+
+ protected:
+    void run() override;
+
+ private:
+    enum ROUTE_TYPE {
+        DRONE_ROUTE,
+        POINT_ROUTE,
+        ELLIPSE_ROUTE,
+        CYLINDER_ROUTE
+    };
+
+    struct Route {
+        ROUTE_TYPE type;
+        quint16 port;
+        // nullptr once item is removed
+        QGraphicsItem *item;
+        // model of item, type given by route type
+        DataModel *model;
+    };
+
+    // fields of one decoded telemetry packet in gui units
+    struct Update {
+        QVector3D pos;
+        QVector3D vel;
+        QVector3D accel;
+        qreal yaw;
+    };
+
+    struct Move {
+        QPointF pos;
+        qreal rotation;
+    };
+
+    // recvmmsg headers and buffers, platform types kept out of header
+    struct Batch;
+
+    // max datagrams taken per receive call
+    static const int BATCH_SIZE = 64;
+    // bytes per datagram buffer, telemetry packets are far smaller
+    static const int BUFFER_SIZE = 4096;
+    // max batches per socket per wakeup so one port cannot starve
+    // the others
+    static const int MAX_BATCHES = 16;
+    // max time to block before rechecking run flag
+    static const int POLL_TIMEOUT_MS = 100;
+
+    // routes and their sockets, socket i serves routes_[i]
+    QVector<Route> routes_;
+    QVector<int> sockets_;
+    // held while applying updates and while removing items
+    QMutex routes_mutex_;
+
+    // moves for GUI thread
+    QHash<QGraphicsItem *, Move> moves_;
+    QMutex moves_mutex_;
+
+    Batch *batch_;
+    // decode buffer of injected datagrams, replay thread only
+    char inject_buffer_[BUFFER_SIZE];
+
+    // nullptr if datagrams are not recorded
+    SessionRecorder *recorder_;
+
+    // receive loop flag
+    bool run_loop_;
+    QMutex mutex_;
+    bool getRunFlag();
+
+    // counts since stats were last taken
+    QElapsedTimer stats_clock_;
+    QAtomicInteger<quint64> packets_;
+    QAtomicInteger<quint64> receive_calls_;
+    QAtomicInteger<quint64> bad_packets_;
+    // ports that could not be bound on last start
+    QAtomicInt bind_errors_;
+
+    void addRoute(ROUTE_TYPE type, quint16 port, QGraphicsItem *item,
+                  DataModel *model);
+    void openSockets();
+    void closeSockets();
+    // receive up to BATCH_SIZE datagrams into batch, count or -1
+    int receiveBatch(int socket);
+    // drain socket and apply newest valid datagram to its route
+    void drainSocket(int index, qint64 time_usec);
+    // decode telemetry datagram, false if invalid
+    bool decodeDatagram(char *data, int length, Update *update);
+    // set route model and post graphic move, caller holds routes lock
+    void applyUpdate(Route const &route, Update const &update,
+                     qint64 time_usec);
+};
+
+}  // namespace optgui
+
+#endif  // NETWORK_INGEST_H_
@@ -0,0 +1,88 @@
+// TITLE:   Optimization_Interface/include/network/session_log.h
+// AUTHORS: Daniel Sullivan
+// LAB:     Autonomous Controls Lab (ACL)
+// LICENSE: Copyright 2020, All Rights Reserved
+
+// Binary format of recorded telemetry and operator edit sessions
+
+#ifndef SESSION_LOG_H_
+#define SESSION_LOG_H_
+
+#include <QIODevice>
+#include <QDataStream>
+#include <QByteArray>
+#include <QString>
+
+namespace optgui {
+
+// One inbound datagram or operator edit
+struct SessionEvent {
+    enum EVENT_TYPE {
+        DATAGRAM_EVENT = 1,
+        EDIT_EVENT = 2
+    };
+
+    // operator edits replayed through the controller
+    enum EDIT_TYPE {
+        EXECUTE_EDIT = 1,
+        STAGE_EDIT = 2,
+        UNSTAGE_EDIT = 3,
+        FINAL_TIME_EDIT = 4,
+        FREE_FINAL_TIME_EDIT = 5,
+        TRAJ_LOCK_EDIT = 6,
+        MPC_EDIT = 7,
+        SIMULATED_EDIT = 8
+    };
+
+    // monotonic usec since recording started
+    qint64 time_usec;
+    quint8 type;
+    // port of datagram, or edit type
+    quint16 code;
+    // datagram bytes, or edit value as a little endian double
+    QByteArray data;
+};
+
+// Little endian. Header is magic, version and wall clock msec of
+// start. Events follow until end of file, each is time, type, code,
+// data length then data
+class SessionLogWriter {
+ public:
+    static const quint32 MAGIC = 0x4F534553;  // "OSES"
+    static const quint32 VERSION = 1;
+
+    // edit values take this many bytes
+    static const int EDIT_VALUE_SIZE = 8;
+
+    // write header to device, false if it failed
+    static bool writeHeader(QIODevice *device, qint64 start_msec);
+    // append encoded event to buffer, no allocation once buffer
+    // has grown
+    static void appendEvent(QByteArray *buffer, qint64 time_usec,
+                            quint8 type, quint16 code,
+                            char const *data, int length);
+    // write EDIT_VALUE_SIZE bytes of edit value to data
+    static void encodeEditValue(double value, char *data);
+};
+
+class SessionLogReader {
+ public:
+    // read header from device, false if not a session log
+    bool open(QIODevice *device);
+    // next event, false at end or on error
+    bool readEvent(SessionEvent *event);
+    QString getError();
+    qint64 getStartMsec();
+
+    // value of edit event
+    static double getEditValue(SessionEvent const &event);
+
+ private:
+    QDataStream stream_;
+    qint64 start_msec_;
+    QString error_;
+};
+
+}  // namespace optgui
+
+#endif  // SESSION_LOG_H_
@@ -0,0 +1,85 @@
+// TITLE:   Optimization_Interface/include/network/session_recorder.h
+// AUTHORS: Daniel Sullivan
+// LAB:     Autonomous Controls Lab (ACL)
+// LICENSE: Copyright 2020, All Rights Reserved
+
+// Records inbound telemetry and operator edits on a background thread
+
+#ifndef SESSION_RECORDER_H_
+#define SESSION_RECORDER_H_
+
+#include <QThread>
+#include <QMutex>
+#include <QWaitCondition>
+#include <QFile>
+#include <QByteArray>
+#include <QAtomicInteger>
+
+#include "include/network/session_log.h"
+
+namespace optgui {
+
+// Ingest thread records datagrams and GUI thread records edits, both
+// append encoded events to a shared buffer under a short lock. The
+// writer swaps the buffer out and writes it, waking and dropping as
+// in FlightRecorder with MAX_BUFFER_BYTES as the limit
+class SessionRecorder : public QThread {
+    Q_OBJECT
+
+ public:
+    SessionRecorder();
+    ~SessionRecorder();
+
+    // GUI thread, close any open session and record to filename,
+    // false if it could not be created
+    bool open(QString const &filename);
+    // GUI thread, write buffered events and stop writer
+    void close();
+    bool isOpen();
+
+    // any thread, ignored while closed. Datagrams drained in one
+    // ingest wakeup are recorded with its monotonic time_usec, so
+    // replay can coalesce them the same way
+    void recordDatagram(quint16 port, char const *data, int length,
+                        qint64 time_usec);
+    void recordEdit(SessionEvent::EDIT_TYPE edit, double value = 0);
+    // events dropped since open
+    quint64 getDropped();
+
+ protected:
+    void run() override;
+
+ private:
+    // writer wakeup period
+    static const unsigned long WRITE_INTERVAL_MS = 100;
+    // buffer capacity, about a second of heavy telemetry
+    static const int INITIAL_BUFFER_BYTES = 1024 * 1024;
+    // buffered bytes before events are dropped
+    static const int MAX_BUFFER_BYTES = 64 * 1024 * 1024;
+
+    QFile *file_;
+    // start of session on monotonic clock
+    qint64 start_usec_;
+
+    // events not yet written, and buffer being written
+    QByteArray buffer_;
+    QByteArray writing_;
+    // checked before locking so idle ingest does not lock
+    QAtomicInt is_recording_;
+    QAtomicInteger<quint64> dropped_;
+    QMutex buffer_mutex_;
+
+    // write loop flag, writer waits on stop between writes
+    bool run_loop_;
+    QMutex mutex_;
+    QWaitCondition stop_;
+
+    void recordEvent(quint8 type, quint16 code, char const *data,
+                     int length, qint64 time_usec);
+    // swap out buffered events and write them
+    void writeBuffer();
+};
+
+}  // namespace optgui
+
+#endif  // SESSION_RECORDER_H_
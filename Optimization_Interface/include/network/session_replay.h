@@ -0,0 +1,75 @@
+// TITLE:   Optimization_Interface/include/network/session_replay.h
+// AUTHORS: Daniel Sullivan
+// LAB:     Autonomous Controls Lab (ACL)
+// LICENSE: Copyright 2020, All Rights Reserved
+
+// Plays recorded sessions back through telemetry ingest
+
+#ifndef SESSION_REPLAY_H_
+#define SESSION_REPLAY_H_
+
+#include <QThread>
+#include <QMutex>
+#include <QFile>
+#include <QElapsedTimer>
+#include <QAtomicInteger>
+
+#include "include/network/session_log.h"
+#include "include/network/network_ingest.h"
+
+namespace optgui {
+
+// Datagrams are injected into ingest routes by port, so the config
+// the session was recorded with must be loaded and its ports set.
+// Edits are signalled to the GUI thread. Events keep their recorded
+// spacing at 1x, or are played without waiting when fast
+class SessionReplay : public QThread {
+    Q_OBJECT
+
+ public:
+    explicit SessionReplay(NetworkIngest *ingest);
+    ~SessionReplay();
+
+    // GUI thread, stop any replay and play filename, false if it
+    // is not a session log, see getError
+    bool startReplay(QString const &filename, bool is_fast);
+    // GUI thread, stop playing and join thread
+    void stopReplay();
+    QString getError();
+
+    // event rate and speed against recording since last call
+    QString takeStatsText();
+
+ signals:
+    // operator edit of SessionEvent::EDIT_TYPE is due
+    void edit(int edit, double value);
+
+ protected:
+    void run() override;
+
+ private:
+    // max sleep before rechecking run flag
+    static const qint64 MAX_SLEEP_USEC = 100000;
+
+    NetworkIngest *ingest_;
+    QFile *file_;
+    SessionLogReader reader_;
+    bool is_fast_;
+    QString error_;
+
+    // counts since stats were last taken
+    QElapsedTimer stats_clock_;
+    QAtomicInteger<quint64> events_;
+    // session time of last played event
+    QAtomicInteger<qint64> session_usec_;
+    qint64 stats_session_usec_;
+
+    // replay loop flag
+    bool run_loop_;
+    QMutex mutex_;
+    bool getRunFlag();
+};
+
+}  // namespace optgui
+
+#endif  // SESSION_REPLAY_H_
@@ -0,0 +1,73 @@
+// TITLE:   Optimization_Interface/include/network/trajectory_uplink.h
+// AUTHORS: Daniel Sullivan, Miki Szmuk
+// LAB:     Autonomous Controls Lab (ACL)
+// LICENSE: Copyright 2020, All Rights Reserved
+
+// UDP uplink for sending trajectories to drones over network,
+// telemetry is received by NetworkIngest
+
+#ifndef TRAJECTORY_UPLINK_H_
+#define TRAJECTORY_UPLINK_H_
+
+#include <QUdpSocket>
+#include <QHostAddress>
+#include <QHash>
+
+#include "autogen/lib.h"
+
+#include "include/models/drone_model_item.h"
+
+namespace optgui {
+
+// One socket sends to every drone. Destinations are parsed and
+// validated when a drone is added, which happens again whenever
+// ports change, so sends skip string handling. Packets are
+// serialized into one reused buffer. GUI thread only
+class TrajectoryUplink {
+ public:
+    TrajectoryUplink();
+    ~TrajectoryUplink();
+
+    // cache destination of drone, drones without a valid address
+    // count every send as dropped
+    void addDrone(DroneModelItem *drone);
+    void removeDrone(DroneModelItem *drone);
+    void clearDrones();
+
+    // serialize and send traj to drone, false if dropped
+    bool send(DroneModelItem *drone,
+              autogen::packet::traj2dof const &traj);
+
+    // sends, drops and send latency per drone since last call
+    QString takeStatsText();
+
+ private:
+    struct Destination {
+        QHostAddress address;
+        quint16 port;
+        bool is_valid;
+        // counts since stats were last taken
+        quint64 sent;
+        quint64 dropped;
+        qint64 total_usec;
+        qint64 max_usec;
+    };
+
+    // serialized traj2dof bytes, packets are checked against it
+    static const int BUFFER_SIZE = 4096;
+
+    QUdpSocket socket_;
+    QHash<DroneModelItem *, Destination> destinations_;
+    // reused so sends neither allocate nor zero a buffer
+    autogen::serializable::traj2dof
+            <autogen::topic::traj2dof::UNDEFINED> packet_;
+    char buffer_[BUFFER_SIZE];
+
+    // check if destination address is valid
+    static bool isDestinationAddrValid(QString const &ip_addr,
+                                       quint16 port);
+};
+
+}  // namespace optgui
+
+#endif  // TRAJECTORY_UPLINK_H_
@@ -25,22 +25,6 @@ class LoadDialog : public QDialog {
 
     // load configuration file
     void loadConfig(ConstraintModel *model);
-
-    QVector<EllipseModelItem *> ellipses_;
-    QVector<CylinderModelItem *> cylinders_;
-    QSet<PolygonModelItem *> polygons_;
-    QVector<PointModelItem *> waypoints_;
-    QSet<PointModelItem *> final_points_;
-    DroneModelItem* drone_;
-
-    qreal wid;
-    qreal hei;
-    qreal rot;
-    qreal trigwid;
-    QPointF pos;
-    qreal cle;
-    quint16 por = NULL;
-
 };
 
 }  // namespace optgui
@@ -0,0 +1,56 @@
+#-------------------------------------------------
+#
+# Headless batch planner, plans config file
+# scenarios without a display
+#
+#-------------------------------------------------
+
+# widgets only linked for constraint model table setters,
+# no QApplication is created
+QT       += core widgets
+
+CONFIG   += console
+CONFIG   -= app_bundle
+
+TARGET = optgui_batch
+TEMPLATE = app
+
+DEFINES += QT_DEPRECATED_WARNINGS
+
+# skyenet and mikipilot, shared with GUI
+include(dependencies.pri)
+
+SOURCES += \
+    src/batch_main.cpp \
+    src/controls/batch_planner.cpp \
+    src/controls/solver_outputs.cpp \
+    src/controls/trajectory_solver.cpp \
+    src/controls/reference_solver.cpp \
+    src/models/constraint_model.cpp \
+    src/models/obstacle_index.cpp \
+    src/models/config_reader.cpp \
+    src/globals.cpp \
+    src/window/port_dialog/drone_id_selector.cpp \
+    src/window/port_dialog/port_selector.cpp
+
+HEADERS += \
+    include/controls/batch_planner.h \
+    include/controls/solver_outputs.h \
+    include/controls/trajectory_solver.h \
+    include/controls/reference_solver.h \
+    include/globals.h \
+    include/models/constraint_model.h \
+    include/models/constraint_snapshot.h \
+    include/models/config_reader.h \
+    include/models/ellipse_model_item.h \
+    include/models/ellipse_store.h \
+    include/models/obstacle_index.h \
+    include/models/cylinder_model_item.h \
+    include/models/polygon_model_item.h \
+    include/models/plane_model_item.h \
+    include/models/path_model_item.h \
+    include/models/drone_model_item.h \
+    include/models/point_model_item.h \
+    include/models/data_model.h \
+    include/window/port_dialog/drone_id_selector.h \
+    include/window/port_dialog/port_selector.h
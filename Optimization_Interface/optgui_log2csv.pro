@@ -0,0 +1,24 @@
+#-------------------------------------------------
+#
+# Flight log converter, writes binary flight logs
+# recorded by the GUI as csv
+#
+#-------------------------------------------------
+
+QT       += core
+QT       -= gui
+
+CONFIG   += console
+CONFIG   -= app_bundle
+
+TARGET = optgui_log2csv
+TEMPLATE = app
+
+DEFINES += QT_DEPRECATED_WARNINGS
+
+SOURCES += \
+    src/log2csv_main.cpp \
+    src/controls/flight_log.cpp
+
+HEADERS += \
+    include/controls/flight_log.h
@@ -0,0 +1,29 @@
+#-------------------------------------------------
+#
+# Obstacle overlap benchmark, grid broad phase
+# against testing all pairs
+#
+#-------------------------------------------------
+
+# widgets only for globals colors and graphics types
+QT       += core gui widgets
+
+CONFIG   += console
+CONFIG   -= app_bundle
+
+TARGET = optgui_obstacle_bench
+TEMPLATE = app
+
+DEFINES += QT_DEPRECATED_WARNINGS
+
+SOURCES += \
+    src/obstacle_bench_main.cpp \
+    src/models/obstacle_index.cpp \
+    src/globals.cpp
+
+HEADERS += \
+    include/globals.h \
+    include/models/data_model.h \
+    include/models/ellipse_model_item.h \
+    include/models/cylinder_model_item.h \
+    include/models/obstacle_index.h
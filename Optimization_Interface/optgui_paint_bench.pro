@@ -0,0 +1,34 @@
+#-------------------------------------------------
+#
+# Trajectory paint benchmark, draws a full horizon
+# path into an offscreen image
+#
+#-------------------------------------------------
+
+QT       += core gui widgets
+
+CONFIG   += console
+CONFIG   -= app_bundle
+
+TARGET = optgui_paint_bench
+TEMPLATE = app
+
+DEFINES += QT_DEPRECATED_WARNINGS
+
+# skyenet for horizon size and mikipilot for trajectory frames
+include(dependencies.pri)
+
+SOURCES += \
+    src/paint_bench_main.cpp \
+    src/controls/trajectory_solver.cpp \
+    src/controls/reference_solver.cpp \
+    src/graphics/path_graphics_item.cpp \
+    src/globals.cpp
+
+HEADERS += \
+    include/controls/trajectory_solver.h \
+    include/controls/reference_solver.h \
+    include/globals.h \
+    include/graphics/path_graphics_item.h \
+    include/models/data_model.h \
+    include/models/path_model_item.h
@@ -0,0 +1,23 @@
+#-------------------------------------------------
+#
+# UDP telemetry load generator, replays moving
+# vehicles to GUI ports for network load tests
+#
+#-------------------------------------------------
+
+QT       += core network
+QT       -= gui
+
+CONFIG   += console
+CONFIG   -= app_bundle
+
+TARGET = optgui_udpgen
+TEMPLATE = app
+
+DEFINES += QT_DEPRECATED_WARNINGS
+
+# mikipilot packets, shared with GUI
+include(dependencies.pri)
+
+SOURCES += \
+    src/udpgen_main.cpp
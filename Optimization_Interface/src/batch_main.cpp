@@ -0,0 +1,93 @@
+// TITLE:   Optimization_Interface/src/batch_main.cpp
+// AUTHORS: Daniel Sullivan
+// LAB:     Autonomous Controls Lab (ACL)
+// LICENSE: Copyright 2020, All Rights Reserved
+
+// Plans config file scenarios in parallel without a display
+
+#include <QCoreApplication>
+#include <QCommandLineParser>
+#include <QThreadPool>
+#include <QDir>
+#include <QFile>
+#include <QTextStream>
+
+#include "include/controls/batch_planner.h"
+
+using optgui::BatchPlanner;
+
+int main(int argc, char *argv[]) {
+    QCoreApplication app(argc, argv);
+    QCoreApplication::setApplicationName("optgui_batch");
+
+    QCommandLineParser parser;
+    parser.setApplicationDescription(
+                "Plan trajectories for config file scenarios");
+    parser.addHelpOption();
+    parser.addPositionalArgument("configs", "Scenario config files",
+                                 "<file.config>...");
+    QCommandLineOption output_option(
+                QStringList() << "o" << "output",
+                "Directory for results, default current.", "dir", ".");
+    QCommandLineOption jobs_option(
+                QStringList() << "j" << "jobs",
+                "Scenarios solved in parallel, default all cores.", "n");
+    QCommandLineOption passes_option(
+                "max-passes", "Max solver passes per target, default 10.",
+                "n", "10");
+    QCommandLineOption free_final_time_option(
+                "free-final-time", "Solve for final time.");
+    parser.addOption(output_option);
+    parser.addOption(jobs_option);
+    parser.addOption(passes_option);
+    parser.addOption(free_final_time_option);
+    parser.process(app);
+
+    QStringList config_files = parser.positionalArguments();
+    if (config_files.isEmpty()) {
+        parser.showHelp(1);
+    }
+
+    BatchPlanner::Options options;
+    options.output_dir = parser.value(output_option);
+    options.is_free_final_time = parser.isSet(free_final_time_option);
+    options.max_passes = qMax(1u, parser.value(passes_option).toUInt());
+    QDir().mkpath(options.output_dir);
+
+    // one scenario per pool thread
+    QThreadPool *pool = QThreadPool::globalInstance();
+    if (parser.isSet(jobs_option)) {
+        pool->setMaxThreadCount(qMax(1, parser.value(jobs_option).toInt()));
+    }
+    QVector<BatchPlanner *> planners;
+    for (QString const &config_file : config_files) {
+        BatchPlanner *planner = new BatchPlanner(config_file, options);
+        planners.append(planner);
+        pool->start(planner);
+    }
+    pool->waitForDone();
+
+    // summary in input order
+    QTextStream err(stderr);
+    int exit_code = 0;
+    QFile summary_file(QDir(options.output_dir).filePath("summary.csv"));
+    if (!summary_file.open(QIODevice::WriteOnly | QIODevice::Text)) {
+        err << summary_file.errorString() << endl;
+        exit_code = 1;
+    }
+    QTextStream summary(&summary_file);
+    summary << BatchPlanner::getSummaryHeader() << endl;
+    for (int i = 0; i < planners.size(); i++) {
+        for (QString const &row : planners.at(i)->getSummary()) {
+            summary << row << endl;
+        }
+        if (!planners.at(i)->getError().isEmpty()) {
+            err << config_files.at(i) << ": "
+                << planners.at(i)->getError() << endl;
+            exit_code = 1;
+        }
+        delete planners.at(i);
+    }
+
+    return exit_code;
+}
@@ -0,0 +1,156 @@
+// TITLE:   Optimization_Interface/src/controls/batch_planner.cpp
+// AUTHORS: Daniel Sullivan
+// LAB:     Autonomous Controls Lab (ACL)
+// LICENSE: Copyright 2020, All Rights Reserved
+
+#include "include/controls/batch_planner.h"
+
+#include <QDir>
+#include <QFile>
+#include <QFileInfo>
+#include <QTextStream>
+#include <QElapsedTimer>
+#include <QVector3D>
+
+#include <algorithm>
+#include <memory>
+
+#include "include/globals.h"
+#include "include/models/constraint_model.h"
+#include "include/models/config_reader.h"
+#include "include/controls/solver_outputs.h"
+
+namespace optgui {
+
+BatchPlanner::BatchPlanner(QString const &config_file,
+                           Options const &options) {
+    this->config_file_ = config_file;
+    this->options_ = options;
+    // results are read after pool finishes
+    this->setAutoDelete(false);
+}
+
+QString BatchPlanner::getSummaryHeader() {
+    return "scenario,target,target_x,target_y,feasible,obs_overlap,"
+           "final_time,peak_accel,passes,solve_ms";
+}
+
+QStringList BatchPlanner::getSummary() {
+    return this->summary_;
+}
+
+QString BatchPlanner::getError() {
+    return this->error_;
+}
+
+void BatchPlanner::run() {
+    // each scenario has its own model, nothing shared between threads
+    ConstraintModel model;
+    if (!ConfigReader::readConfig(this->config_file_, &model,
+                                  &this->error_)) {
+        return;
+    }
+    model.setFreeFinalTime(this->options_.is_free_final_time);
+
+    DroneModelItem *drone = model.getDrones();
+    if (drone == nullptr) {
+        this->error_ = "no drone";
+        return;
+    }
+
+    // final points are unordered in model, sort by pos so
+    // output names are stable between runs
+    QList<PointModelItem *> targets = model.getPoints().values();
+    std::sort(targets.begin(), targets.end(),
+              [](PointModelItem *a, PointModelItem *b) {
+        QPointF pos_a = a->getPos();
+        QPointF pos_b = b->getPos();
+        if (pos_a.x() != pos_b.x()) {
+            return pos_a.x() < pos_b.x();
+        }
+        return pos_a.y() < pos_b.y();
+    });
+    if (targets.isEmpty()) {
+        this->error_ = "no final points";
+        return;
+    }
+
+    // same params assembly as compute threads
+    model.publishSnapshot();
+    std::shared_ptr<ConstraintSnapshot const> snapshot = model.getSnapshot();
+    QString scenario = QFileInfo(this->config_file_).completeBaseName();
+
+    for (int t = 0; t < targets.size(); t++) {
+        // copy params since solver takes non const params
+        skyenet::params P = snapshot->P;
+        double wp[skyenet::MAX_WAYPOINTS][3];
+        std::copy(&snapshot->wp[0][0],
+                  &snapshot->wp[0][0] + (skyenet::MAX_WAYPOINTS * 3),
+                  &wp[0][0]);
+
+        // initial state and final pos in meters
+        QVector3D xyz_drone_pos = guiXyzToXyz(drone->getPos());
+        QVector3D xyz_drone_vel = guiXyzToXyz(drone->getVel());
+        QVector3D xyz_drone_acc = guiXyzToXyz(drone->getAccel());
+        QPointF final_pos = targets.at(t)->getPos();
+        QVector3D xyz_final_pos = guiXyzToXyz(final_pos.x(),
+                                              final_pos.y(), 0);
+        double r_i[3] = {xyz_drone_pos.x(), xyz_drone_pos.y(), 0.0};
+        double v_i[3] = {xyz_drone_vel.x(), xyz_drone_vel.y(),
+                         xyz_drone_vel.z()};
+        double a_i[3] = {xyz_drone_acc.x(), xyz_drone_acc.y(),
+                         xyz_drone_acc.z()};
+        double r_f[3] = {xyz_final_pos.x(), xyz_final_pos.y(),
+                         xyz_final_pos.z()};
+
+        QElapsedTimer timer;
+        timer.start();
+
+        std::unique_ptr<TrajectorySolver> fly(TrajectorySolver::create());
+        fly->setParams(P, r_i, v_i, a_i, r_f, wp);
+        fly->resetInputs(r_i, v_i, a_i, r_f, wp,
+                         this->options_.is_free_final_time);
+        quint32 passes;
+        skyenet::outputs const &O = solveUntilConverged(
+                    fly.get(), P.K, this->options_.is_free_final_time,
+                    this->options_.max_passes, &passes);
+
+        // same trajectory extraction as compute threads
+        QVector<QPointF> trajectory;
+        autogen::packet::traj2dof traj2dof_data;
+        readTrajectory(O, P.K, &trajectory, &traj2dof_data);
+        qint64 solve_ms = timer.elapsed();
+
+        // write reference trajectory in NED
+        QString traj_name = QString("%1_target%2.csv").arg(scenario).arg(t);
+        QFile traj_file(QDir(this->options_.output_dir).filePath(traj_name));
+        if (traj_file.open(QIODevice::WriteOnly | QIODevice::Text)) {
+            QTextStream stream(&traj_file);
+            stream << "time,"
+                   << "pos_ref_n,pos_ref_e,"
+                   << "vel_ref_n,vel_ref_e,"
+                   << "accl_ref_n,accl_ref_e" << endl;
+            for (quint32 i = 0; i < P.K; i++) {
+                stream << traj2dof_data.time(i) << ","
+                       << traj2dof_data.pos_ned(0, i) << ","
+                       << traj2dof_data.pos_ned(1, i) << ","
+                       << traj2dof_data.vel_ned(0, i) << ","
+                       << traj2dof_data.vel_ned(1, i) << ","
+                       << traj2dof_data.accl_ned(0, i) << ","
+                       << traj2dof_data.accl_ned(1, i) << endl;
+            }
+        } else {
+            this->error_ = traj_file.errorString();
+        }
+
+        this->summary_.append(QString("%1,%2,%3,%4,%5,%6,%7,%8,%9,%10")
+                              .arg(scenario).arg(t)
+                              .arg(r_f[0]).arg(r_f[1])
+                              .arg(isFeasible(O) ? 1 : 0)
+                              .arg(snapshot->is_obs_overlap ? 1 : 0)
+                              .arg(O.T).arg(getPeakAccel(O, P.K))
+                              .arg(passes).arg(solve_ms));
+    }
+}
+
+}  // namespace optgui
@@ -0,0 +1,201 @@
+// TITLE:   Optimization_Interface/src/controls/candidate_generator.cpp
+// AUTHORS: Daniel Sullivan
+// LAB:     Autonomous Controls Lab (ACL)
+// LICENSE: Copyright 2020, All Rights Reserved
+
+#include "include/controls/candidate_generator.h"
+
+#include <QRunnable>
+#include <QStringList>
+
+#include <algorithm>
+
+#include "include/controls/solver_outputs.h"
+
+namespace optgui {
+
+// runs one variant on a pool thread
+class CandidateGenerator::Task : public QRunnable {
+ public:
+    Task(CandidateGenerator *generator, int index) {
+        this->generator_ = generator;
+        this->index_ = index;
+    }
+
+    void run() override {
+        this->generator_->solveVariant(this->index_);
+    }
+
+ private:
+    CandidateGenerator *generator_;
+    int index_;
+};
+
+CandidateGenerator::CandidateGenerator(QObject *parent)
+    : QObject(parent), pool_() {
+    this->remaining_ = 0;
+    this->is_running_ = false;
+    this->is_free_final_time_ = false;
+    this->drone_ = nullptr;
+    this->results_data_ = nullptr;
+}
+
+CandidateGenerator::~CandidateGenerator() {
+    this->pool_.waitForDone();
+}
+
+bool CandidateGenerator::generate(
+        DroneModelItem *drone,
+        std::shared_ptr<ConstraintSnapshot const> snapshot,
+        QVector3D const &r_i, QVector3D const &v_i,
+        QVector3D const &a_i, QVector3D const &r_f) {
+    if (this->is_running_) {
+        return false;
+    }
+    this->is_running_ = true;
+    this->drone_ = drone;
+    this->is_free_final_time_ = snapshot->is_free_final_time;
+
+    for (int i = 0; i < 3; i++) {
+        this->r_i_[i] = r_i[i];
+        this->v_i_[i] = v_i[i];
+        this->a_i_[i] = a_i[i];
+        this->r_f_[i] = r_f[i];
+    }
+
+    // final time scales, only an initial guess for free final time
+    qreal const tf_scales[] = {1.0, 0.8, 1.25};
+    // weight scales on min time and min fuel costs
+    qreal const time_scales[] = {1.0, 4.0, 1.0};
+    qreal const fuel_scales[] = {1.0, 1.0, 4.0};
+    // visit waypoints in reverse only if order matters
+    int num_orders = snapshot->P.n_wp > 1 ? 2 : 1;
+
+    this->variants_.clear();
+    for (qreal tf_scale : tf_scales) {
+        for (int weight = 0; weight < 3; weight++) {
+            for (int order = 0; order < num_orders; order++) {
+                Variant variant;
+                variant.P = snapshot->P;
+                std::copy(&snapshot->wp[0][0],
+                          &snapshot->wp[0][0] +
+                          (skyenet::MAX_WAYPOINTS * 3),
+                          &variant.wp[0][0]);
+
+                QStringList label;
+                if (tf_scale != 1.0) {
+                    variant.P.tf *= tf_scale;
+                    label.append(QString("tf x%1").arg(tf_scale));
+                }
+                if (time_scales[weight] != 1.0) {
+                    variant.P.min_time_weight *= time_scales[weight];
+                    label.append(QString("time weight x%1")
+                                 .arg(time_scales[weight]));
+                }
+                if (fuel_scales[weight] != 1.0) {
+                    variant.P.min_fuel_weight *= fuel_scales[weight];
+                    label.append(QString("fuel weight x%1")
+                                 .arg(fuel_scales[weight]));
+                }
+                if (order == 1) {
+                    // reverse waypoint positions, indices stay
+                    // evenly distributed
+                    std::reverse(&variant.wp[0],
+                                 &variant.wp[0] + variant.P.n_wp);
+                    label.append("reversed waypoints");
+                }
+                if (label.isEmpty()) {
+                    label.append("nominal");
+                }
+                variant.label = label.join(", ");
+                this->variants_.append(variant);
+            }
+        }
+    }
+
+    // results are written in place, one slot per task
+    this->results_ = QVector<Candidate>(this->variants_.size());
+    this->results_data_ = this->results_.data();
+    this->remaining_ = this->variants_.size();
+    for (int i = 0; i < this->variants_.size(); i++) {
+        this->pool_.start(new Task(this, i));
+    }
+    return true;
+}
+
+bool CandidateGenerator::isRunning() {
+    return this->is_running_;
+}
+
+DroneModelItem *CandidateGenerator::getDrone() {
+    return this->drone_;
+}
+
+QVector<Candidate> CandidateGenerator::getCandidates() {
+    return this->results_;
+}
+
+void CandidateGenerator::solveVariant(int index) {
+    Variant const &variant = this->variants_.at(index);
+
+    // copy inputs since solver takes non const params
+    skyenet::params P = variant.P;
+    double wp[skyenet::MAX_WAYPOINTS][3];
+    std::copy(&variant.wp[0][0],
+              &variant.wp[0][0] + (skyenet::MAX_WAYPOINTS * 3),
+              &wp[0][0]);
+    double r_i[3];
+    double v_i[3];
+    double a_i[3];
+    double r_f[3];
+    std::copy(this->r_i_, this->r_i_ + 3, r_i);
+    std::copy(this->v_i_, this->v_i_ + 3, v_i);
+    std::copy(this->a_i_, this->a_i_ + 3, a_i);
+    std::copy(this->r_f_, this->r_f_ + 3, r_f);
+
+    // cold start, variants share no iterate
+    std::unique_ptr<TrajectorySolver> fly(TrajectorySolver::create());
+    fly->setParams(P, r_i, v_i, a_i, r_f, wp);
+    fly->resetInputs(r_i, v_i, a_i, r_f, wp, this->is_free_final_time_);
+
+    // run passes until trajectory stops moving
+    quint32 passes;
+    skyenet::outputs const &O = solveUntilConverged(
+                fly.get(), P.K, this->is_free_final_time_, MAX_PASSES,
+                &passes);
+
+    Candidate &candidate = this->results_data_[index];
+    candidate.label = variant.label;
+    readTrajectory(O, P.K, &candidate.points, &candidate.traj2dof);
+    candidate.final_time = O.T;
+    candidate.peak_accel = getPeakAccel(O, P.K);
+    candidate.is_feasible = isFeasible(O);
+
+    // last task hands results to parent thread
+    if (!this->remaining_.deref()) {
+        QMetaObject::invokeMethod(this, "finish", Qt::QueuedConnection);
+    }
+}
+
+void CandidateGenerator::finish() {
+    std::stable_sort(this->results_.begin(), this->results_.end(),
+                     CandidateGenerator::isBetter);
+    this->is_running_ = false;
+    emit candidatesReady();
+}
+
+bool CandidateGenerator::isBetter(Candidate const &a, Candidate const &b) {
+    if (a.is_feasible != b.is_feasible) {
+        return a.is_feasible;
+    }
+    // quantize so near equal final times compare equal and
+    // ordering stays transitive
+    qint64 a_steps = qRound64(a.final_time / FINAL_TIME_TOL);
+    qint64 b_steps = qRound64(b.final_time / FINAL_TIME_TOL);
+    if (a_steps != b_steps) {
+        return a_steps < b_steps;
+    }
+    return a.peak_accel < b.peak_accel;
+}
+
+}  // namespace optgui
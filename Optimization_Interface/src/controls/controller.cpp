@@ -6,13 +6,18 @@
 #include "include/controls/controller.h"
 
 #include <QMessageBox>
+#include <QGuiApplication>
+#include <QScreen>
 #include <QSettings>
 #include <QTranslator>
 #include <QSet>
 #include <QDate>
+#include <QDateTime>
 #include <QTextStream>
 #include <QString>
+#include <QtMath>
 
+#include <algorithm>
 #include <cmath>
 #include <limits>
 
@@ -36,6 +41,39 @@ Controller::Controller(Canvas *canvas) {
 
     this->loaded_model_ = new ConstraintModel();
 
+    // start compute thread pool
+    this->solver_scheduler_ = new SolverScheduler(this->model_);
+    this->replan_rate_ = 0;
+    this->deadline_ = 0;
+    this->anytime_budget_ = 0;
+
+    // show solver results and socket updates at most once per
+    // display refresh
+    qreal refresh_rate = 60;
+    if (QGuiApplication::primaryScreen() != nullptr) {
+        refresh_rate = QGuiApplication::primaryScreen()->refreshRate();
+    }
+    this->repaint_coalescer_ = new RepaintCoalescer(this->canvas_, this);
+    this->trajectory_uplink_ = new TrajectoryUplink();
+    this->network_ingest_ = new NetworkIngest();
+    this->session_recorder_ = new SessionRecorder();
+    this->network_ingest_->setRecorder(this->session_recorder_);
+    this->session_replay_ = new SessionReplay(this->network_ingest_);
+    connect(this->session_replay_, SIGNAL(edit(int, double)),
+            this, SLOT(applyEdit(int, double)));
+    this->notify_timer_ = new QTimer(this);
+    connect(this->notify_timer_, SIGNAL(timeout()),
+            this, SLOT(flushSolverNotifications()));
+    connect(this->notify_timer_, SIGNAL(timeout()),
+            this, SLOT(flushGraphics()));
+    this->notify_timer_->start(qMax(1, qRound(1000 / refresh_rate)));
+
+    // initialize candidate generator
+    this->candidate_generator_ = new CandidateGenerator();
+    this->candidate_drone_ = nullptr;
+    connect(this->candidate_generator_, SIGNAL(candidatesReady()),
+            this, SLOT(showCandidates()));
+
     // set rendering order
     qreal renderLevel = std::numeric_limits<qreal>::max();
 
@@ -65,6 +103,10 @@ Controller::Controller(Canvas *canvas) {
     this->traj_render_level_ = renderLevel;
     renderLevel = std::nextafter(renderLevel, 0);
 
+    // initialize candidate trajectory graphics render level
+    this->candidate_render_level_ = renderLevel;
+    renderLevel = std::nextafter(renderLevel, 0);
+
     // initialize port dialog
     this->port_dialog_ = new PortDialog();
     connect(this->port_dialog_, SIGNAL(setSocketPorts()),
@@ -76,32 +118,34 @@ Controller::Controller(Canvas *canvas) {
     // initialize load dialog
     this->load_dialog_ = new LoadDialog();
 
-    // Initialize freeze_traj timer
-    this->freeze_traj_timer_ = new QTimer();
-    connect(this->freeze_traj_timer_, SIGNAL(timeout()),
+    // Initialize executed traj clock, ticks are queued to GUI thread
+    this->reference_clock_ = new ReferenceClock();
+    connect(this->reference_clock_, SIGNAL(tick()),
             this, SLOT(tickLiveReference()));
+    this->traj_index_ = 0;
     this->is_simulated_ = false;
 
     // Set traj lock. Cannot execute traj while already executing.
     this->traj_lock_ = false;
+    this->splice_version_ = 0;
+    this->splices_ = 0;
+    this->splices_rejected_ = 0;
 
     // Set disable stage bool to false
     this->is_stage_booled_ = false;
 
     // capture data on by default
     this->capture_data_ = true;
-    this->output_file_ = nullptr;
+    this->flight_recorder_ = new FlightRecorder();
 }
 
 Controller::~Controller() {
-    for (ComputeThread *thread : this->compute_threads_) {
-        thread->stopCompute();
-        // delete should be handled by deletelater slot
-//        thread->quit();
-//        thread->wait();
-//        delete thread;
-    }
-    this->compute_threads_.clear();
+    // wait for candidate solves
+    delete this->candidate_generator_;
+
+    // stop compute threads and delete drone contexts
+    delete this->solver_scheduler_;
+    this->solver_contexts_.clear();
 
     // deinitialize port dialog
     delete this->port_dialog_;
@@ -109,14 +153,21 @@ Controller::~Controller() {
     // deinitialize save dialog
     delete this->save_dialog_;
 
-    // deinitialize network
+    // deinitialize network, stops ingest before models are deleted
     this->closeSockets();
+    delete this->session_replay_;
+    delete this->network_ingest_;
+    delete this->trajectory_uplink_;
+    delete this->session_recorder_;
 
     // clean up model
     delete this->model_;
 
-    // clean up timer
-    delete this->freeze_traj_timer_;
+    // clean up clock
+    delete this->reference_clock_;
+
+    // write rest of flight log
+    delete this->flight_recorder_;
 }
 
 // ============ MENU CONTROLS ============
@@ -132,6 +183,10 @@ void Controller::setFinaltime(qreal final_time) {
 // ============ MOUSE CONTROLS ============
 
 void Controller::removeItem(QGraphicsItem *item) {
+    // stop telemetry for graphic and drop any pending move
+    this->network_ingest_->removeItem(item);
+    this->repaint_coalescer_->removeItem(item);
+
     // switch based on custom graphics type
     switch (item->type()) {
         case DRONE_GRAPHIC: {
@@ -140,27 +195,31 @@ void Controller::removeItem(QGraphicsItem *item) {
                     DroneGraphicsItem *>(item);
             DroneModelItem *model = drone->model_;
 
-            // remove drone socket
-            this->removeDroneSocket(model);
+            // remove drone uplink
+            this->trajectory_uplink_->removeDrone(model);
 
             // stop staged or executed drones
-            this->freeze_traj_timer_->stop();
+            this->reference_clock_->stop();
             this->model_->setLiveReferenceMode(false);
             this->unsetStagedPath();
 
-            // remove compute thread
-            QMap<DroneModelItem *, ComputeThread *>::iterator iter =
-                    this->compute_threads_.find(model);
-            if (iter != this->compute_threads_.end()) {
+            // remove candidates for drone
+            if (this->candidate_drone_ == model) {
+                this->clearCandidates();
+            }
+
+            // remove solver context
+            QMap<DroneModelItem *, SolverContext *>::iterator iter =
+                    this->solver_contexts_.find(model);
+            if (iter != this->solver_contexts_.end()) {
                 // get traj
                 PathGraphicsItem *traj = (*iter)->getTrajGraphic();
                 PathModelItem *traj_model = traj->model_;
 
-                // stop compute
-                (*iter)->stopCompute();
-                // deletion will be handled by deletelater slot
+                // stop compute, waits for any running solve
+                this->solver_scheduler_->removeContext(*iter);
                 // remove from map
-                iter = this->compute_threads_.erase(iter);
+                iter = this->solver_contexts_.erase(iter);
 
                 // remove traj
                 this->canvas_->removeItem(traj);
@@ -187,13 +246,8 @@ void Controller::removeItem(QGraphicsItem *item) {
                     PointGraphicsItem *>(item);
             // get data model
             PointModelItem *model = point->model_;
-            for (ComputeThread *thread : this->compute_threads_.values()) {
-                if (model == thread->getTarget()) {
-                    thread->setTarget(nullptr);
-                }
-            }
-            // delete network socket
-            this->removePointSocket(model);
+            // wait for solves using target before deleting it
+            this->solver_scheduler_->removeTarget(model);
             // remove from QGraphicsScene canvas
             this->canvas_->removeItem(point);
             this->canvas_->final_points_.remove(point);
@@ -211,8 +265,6 @@ void Controller::removeItem(QGraphicsItem *item) {
                     EllipseGraphicsItem *>(item);
             // get data model
             EllipseModelItem *model = ellipse->model_;
-            // delete network socket
-            this->removeEllipseSocket(model);
             // remove from QGraphicsScene canvas
             this->canvas_->removeItem(ellipse);
             this->canvas_->ellipse_graphics_.removeOne(ellipse);
@@ -235,8 +287,6 @@ void Controller::removeItem(QGraphicsItem *item) {
                     CylinderGraphicsItem *>(item);
             // get data model
             CylinderModelItem *model = cylinder->model_;
-            // delete network socket
-            this->removeCylinderSocket(model);
             // remove from QGraphicsScene canvas
             this->canvas_->removeItem(cylinder);
             this->canvas_->cylinder_graphics_.removeOne(cylinder);
@@ -293,8 +343,6 @@ void Controller::removeItem(QGraphicsItem *item) {
                     dynamic_cast<WaypointGraphicsItem *>(item);
             // get data model
             PointModelItem *model = waypoint->model_;
-            // delete network socket
-            this->removePointSocket(model);
             // remove from QGraphicsScene canvas
             this->canvas_->removeItem(waypoint);
             this->canvas_->waypoint_graphics_.removeOne(waypoint);
@@ -309,12 +357,17 @@ void Controller::removeItem(QGraphicsItem *item) {
             }
 
             // update all traj's to no have waypoint
-            for (ComputeThread *thread : this->compute_threads_) {
-                thread->reInit();
+            for (SolverContext *context : this->solver_contexts_) {
+                context->reInit();
             }
 
             break;
         }
+        case CANDIDATE_GRAPHIC: {
+            // remove all candidates, ranks shown are relative
+            this->clearCandidates();
+            break;
+        }
     }
 }
 
@@ -474,12 +527,26 @@ void Controller::setExecutedDrone(DroneModelItem *drone_model) {
 }
 
 void Controller::finalTime(DroneModelItem *drone, qreal time) {
+    // only show solved time, writing it to params would change the
+    // inputs of every context and solve again
     if (this->model_->isCurrDrone(drone)) {
-        this->setFinaltime(time);
         emit this->finalTime(time);
     }
 }
 
+void Controller::flushSolverNotifications() {
+    // publish edits since last flush to compute threads
+    this->model_->publishSnapshot();
+    for (SolverContext *context : this->solver_contexts_) {
+        context->flushNotifications();
+    }
+}
+
+void Controller::flushGraphics() {
+    this->network_ingest_->takeMoves(this->repaint_coalescer_);
+    this->repaint_coalescer_->flush();
+}
+
 void Controller::updateMessage(DroneModelItem *drone) {
     if (this->model_->isCurrDrone(drone)) {
         emit this->updateMessage();
@@ -487,12 +554,12 @@ void Controller::updateMessage(DroneModelItem *drone) {
 }
 
 void Controller::freeze_traj() {
-    // compute time difference between each point on traj
-    int msec = (1000 * this->model_->getFinaltime()) /
-            (this->model_->getHorizon() - 1);
-    // start timer to next time interval
-    this->freeze_traj_timer_->start(msec);
-    if (this->traj_lock_) {
+    // schedule traj nodes at their solved times from now
+    this->reference_clock_->schedule(
+                this->model_->getStagedTraj2dof(),
+                this->model_->getPathStagedPoints().size());
+    // mpc replans only while solves for staged drone are not paused
+    if (this->traj_lock_ || this->model_->isMpc()) {
         this->model_->setLiveReferenceMode(true);
     } else {
         this->model_->setLiveReferenceMode(false);
@@ -506,7 +573,6 @@ void Controller::freeze_traj() {
                                this->model_->getStagedDrone(),
                                this->traj_index_);
     }
-    this->traj_index_++;
 }
 
 void Controller::setStagedPath() {
@@ -515,6 +581,7 @@ void Controller::setStagedPath() {
     this->setStagedDrone(this->model_->getStagedDrone());
     this->canvas_->path_staged_graphic_->setColor(GREEN);
     // re-render staged traj
+    this->canvas_->path_staged_graphic_->updateGeometry();
     this->canvas_->path_staged_graphic_->update(
                 this->canvas_->path_staged_graphic_->boundingRect());
 }
@@ -526,15 +593,28 @@ void Controller::unsetStagedPath() {
         drone->is_staged_drone_ = false;
         drone->is_executed_drone_ = false;
     }
+    this->canvas_->path_staged_graphic_->updateGeometry();
     this->canvas_->path_staged_graphic_->update(
                 this->canvas_->path_staged_graphic_->boundingRect());
 }
 
 void Controller::tickLiveReference() {
-    // move to next traj point in model
-    if (this->model_->tickPathStaged()) {
+    // tick queued before clock stopped
+    if (!this->reference_clock_->isRunning()) {
+        return;
+    }
+    // node due by elapsed time, ticks can arrive late or twice
+    int index = this->reference_clock_->takeIndex();
+    if (index <= this->traj_index_) {
+        return;
+    }
+    this->traj_index_ = index;
+
+    // move to traj point in model
+    if (this->model_->setPathStagedIndex(index)) {
         // more points in tracked traj
-        autogen::packet::traj2dof traj = this->model_->getStagedTraj2dof();
+        autogen::packet::traj2dof const &traj =
+                this->model_->getStagedTraj2dof();
 
         // get graphic for current drone
         DroneGraphicsItem *drone = nullptr;
@@ -546,52 +626,48 @@ void Controller::tickLiveReference() {
             }
         }
 
-        int index = this->traj_index_;
-
         // update drone with reference telemetry in simulation mode
         if (this->is_simulated_) {
             QVector3D coords = nedToGuiXyz(traj.pos_ned(0, index),
                                            traj.pos_ned(1, index),
                                            traj.pos_ned(2, index));
-
-            staged_drone->
-                    setVel(nedToGuiXyz(traj.vel_ned(0, index),
-                                       traj.vel_ned(1, index),
-                                       traj.vel_ned(2, index)));
-            staged_drone->
-                    setAccel(nedToGuiXyz(traj.accl_ned(0, index),
-                                         traj.accl_ned(1, index),
-                                         traj.accl_ned(2, index)));
-
-            // set model pos
-            staged_drone->setPos(coords);
+            QVector3D vel = nedToGuiXyz(traj.vel_ned(0, index),
+                                        traj.vel_ned(1, index),
+                                        traj.vel_ned(2, index));
+            QVector3D accel = nedToGuiXyz(traj.accl_ned(0, index),
+                                          traj.accl_ned(1, index),
+                                          traj.accl_ned(2, index));
+
+            // set model state in one sample so solvers never read
+            // a mix of old and new fields
+            staged_drone->setState(coords, vel, accel, getMonotonicUsec());
             // set graphic pos so view knows to draw offscreen
             drone->setPos(QPointF(coords.x(), coords.y()));
         }
 
         // update output file
-        if (this->capture_data_ && this->output_file_ != nullptr) {
+        if (this->capture_data_) {
             this->updateOutputFile(traj, staged_drone, index);
         }
 
-        this->traj_index_++;
+        // continue along newest receding horizon
+        if (this->model_->isMpc()) {
+            this->spliceHorizon();
+        }
     } else {
         // close output file
-        if (this->output_file_ != nullptr) {
-            this->output_file_->close();
-            delete this->output_file_;
-            this->output_file_ = nullptr;
-        }
+        this->flight_recorder_->close();
 
         // no more points in tracked traj
-        // stop timer between traj time points
-        this->freeze_traj_timer_->stop();
+        // stop clock between traj time points
+        this->reference_clock_->stop();
         // flag to stop tracking executed traj
         this->model_->setLiveReferenceMode(false);
         // unstage traj
         this->unsetStagedPath();
     }
     // re-render staged traj
+    this->canvas_->path_staged_graphic_->updateGeometry();
     this->canvas_->path_staged_graphic_->update(
                 this->canvas_->path_staged_graphic_->boundingRect());
 }
@@ -603,9 +679,9 @@ void Controller::execute() {
     // get staged drone
     DroneModelItem *staged_drone = this->model_->getStagedDrone();
 
-    if (!this->freeze_traj_timer_->isActive() &&
+    if (!this->reference_clock_->isRunning() &&
             this->model_->getIsTrajStaged()) {
-        // start timer between traj
+        // start clock between traj
         this->freeze_traj();
         // set color to executed
         this->canvas_->path_staged_graphic_->setColor(CYAN);
@@ -618,16 +694,17 @@ void Controller::execute() {
         }
 
         // find traj and set it
-        QMap<DroneModelItem *, ComputeThread *>::iterator iter =
-                this->compute_threads_.find(staged_drone);
-        if (iter != this->compute_threads_.end()) {
+        QMap<DroneModelItem *, SolverContext *>::iterator iter =
+                this->solver_contexts_.find(staged_drone);
+        if (iter != this->solver_contexts_.end()) {
             (*iter)->getTrajGraphic()->model_->
                     setPoints(this->model_->getPathStagedPoints());
         }
 
-        emit trajectoryExecuted(staged_drone,
-                                this->model_->getStagedTraj2dof());
-    } else if (this->freeze_traj_timer_->isActive() &&
+        this->trajectory_uplink_->send(staged_drone,
+                                       this->model_->getStagedTraj2dof());
+        this->resetSplice();
+    } else if (this->reference_clock_->isRunning() &&
                !this->traj_lock_ &&
                this->model_->getIsValidTraj() == FEASIBILITY_CODE::FEASIBLE) {
         this->setStagedPath();
@@ -635,80 +712,118 @@ void Controller::execute() {
         this->canvas_->path_staged_graphic_->setColor(CYAN);
         // this->model_->setPathPoints(this->model_->getPathStagedPoints());
 
-        emit trajectoryExecuted(staged_drone,
-                                this->model_->getStagedTraj2dof());
+        this->trajectory_uplink_->send(staged_drone,
+                                       this->model_->getStagedTraj2dof());
+        this->resetSplice();
     }
 }
 
-void Controller::createOutputFile() {
-    // close old output file if exists
-    if (this->output_file_ != nullptr) {
-        this->output_file_->close();
-        delete this->output_file_;
-        this->output_file_ = nullptr;
+void Controller::resetSplice() {
+    // only horizons solved after this are spliced
+    DroneModelItem *staged_drone = this->model_->getStagedDrone();
+    QMap<DroneModelItem *, SolverContext *>::iterator iter =
+            this->solver_contexts_.find(staged_drone);
+    if (iter != this->solver_contexts_.end()) {
+        this->splice_version_ =
+                (*iter)->getTrajGraphic()->model_->getVersion();
     }
+}
 
-    // create file in same directory as executable
-    QString filename = QDate::currentDate().toString("'data_'MM_dd_yyyy'");
-    filename.append(QTime::currentTime().toString("'_'hh.mm.ss'.csv'"));
+void Controller::spliceHorizon() {
+    DroneModelItem *staged_drone = this->model_->getStagedDrone();
+    QMap<DroneModelItem *, SolverContext *>::iterator iter =
+            this->solver_contexts_.find(staged_drone);
+    if (iter == this->solver_contexts_.end()) {
+        return;
+    }
 
-    this->output_file_ = new QFile(filename);
+    // skip until a new horizon is published
+    PathModelItem *traj_model = (*iter)->getTrajGraphic()->model_;
+    quint64 version = traj_model->getVersion();
+    if (version == this->splice_version_) {
+        return;
+    }
+    this->splice_version_ = version;
 
-    if (this->output_file_->open(QIODevice::WriteOnly | QIODevice::Text)) {
-        QTextStream stream(this->output_file_);
+    TrajectoryFrame const &frame = traj_model->getFrame();
+    QVector<QPointF> reference = this->model_->getPathStagedPoints();
+    if (frame.points.size() < 2 || reference.isEmpty()) {
+        return;
+    }
 
-        stream << "abs_time,rel_time,"
+    // horizon starts at state predicted for end of its solve, keep
+    // active reference if horizon is infeasible or would jump away
+    // from the reference point being tracked
+    QPointF jump = frame.points.first() - reference.first();
+    if (!frame.is_feasible ||
+            QPointF::dotProduct(jump, jump) >
+            qPow(MAX_SPLICE_JUMP * GRID_SIZE, 2)) {
+        this->splices_rejected_++;
+        return;
+    }
 
-               << "pos_ref_n,pos_ref_e,pos_ref_d,"
-               << "vel_ref_n,vel_ref_e,vel_ref_d,"
-               << "accl_ref_n,accl_ref_e,accl_ref_d,"
+    // drone has arrived, let active reference run out
+    QPointF travel = frame.points.last() - frame.points.first();
+    if (QPointF::dotProduct(travel, travel) <
+            qPow(ARRIVAL_TOL * GRID_SIZE, 2)) {
+        return;
+    }
 
-               << "pos_telem_n,pos_telem_e,pos_telem_d,"
-               << "vel_telem_n,vel_telem_e,vel_telem_d,"
-               << "accl_telem_n,accl_telem_e,accl_telem_d,"
+    // replace rest of reference with horizon and send it
+    this->model_->stageTraj(staged_drone, frame);
+    this->trajectory_uplink_->send(staged_drone, frame.traj2dof);
+    this->splices_++;
 
-               << "pos_diff_n,pos_diff_e,pos_diff_d,"
-               << "vel_diff_n,vel_diff_e,vel_diff_d,"
-               << "accl_diff_n,accl_diff_e,accl_diff_d"
+    // horizon starts now, node spacing changes with free final time
+    this->reference_clock_->schedule(frame.traj2dof, frame.points.size());
+    this->traj_index_ = 0;
+}
 
-               << endl;
-    } else {
-        delete this->output_file_;
-        this->output_file_ = nullptr;
-    }
+void Controller::createOutputFile() {
+    // create file in same directory as executable, closes old one
+    QString filename = QDate::currentDate().toString("'data_'MM_dd_yyyy'");
+    filename.append(QTime::currentTime().toString("'_'hh.mm.ss'.flight'"));
+    this->flight_recorder_->open(filename);
 }
 
 void Controller::updateOutputFile(autogen::packet::traj2dof const &traj, DroneModelItem *staged_drone, int index) {
-    QTextStream stream(this->output_file_);
-
-    // time
-    stream << QTime::currentTime().toString("hh.mm.ss") << "," << traj.time(index) << ",";
+    // columns in FlightLogWriter::getColumns order, convert to csv
+    // offline with optgui_log2csv
+    FlightRecord record;
+    record.abs_time = QDateTime::currentMSecsSinceEpoch();
+    double *value = record.values;
+    *value++ = traj.time(index);
 
     // ref
-    stream << traj.pos_ned(0, index) << "," << traj.pos_ned(1, index) << "," << traj.pos_ned(2, index) << ","
-           << traj.vel_ned(0, index) << "," << traj.vel_ned(1, index) << "," << traj.vel_ned(2, index) << ","
-           << traj.accl_ned(0, index) << "," << traj.accl_ned(1, index) << "," << traj.accl_ned(2, index) << ",";
+    for (int i = 0; i < 3; i++) {
+        *value++ = traj.pos_ned(i, index);
+    }
+    for (int i = 0; i < 3; i++) {
+        *value++ = traj.vel_ned(i, index);
+    }
+    for (int i = 0; i < 3; i++) {
+        *value++ = traj.accl_ned(i, index);
+    }
 
     // telem
-    QVector3D pos_telem_ned(guiXyzToNED(staged_drone->getPos()));
-    QVector3D vel_telem_ned(guiXyzToNED(staged_drone->getVel()));
-    QVector3D accl_telem_ned(guiXyzToNED(staged_drone->getAccel()));
-    stream << pos_telem_ned.x() << "," << pos_telem_ned.y() << "," << pos_telem_ned.z() << ","
-           << vel_telem_ned.x() << "," << vel_telem_ned.y() << "," << vel_telem_ned.z() << ","
-           << accl_telem_ned.x() << "," << accl_telem_ned.y() << "," << accl_telem_ned.z() << ",";
-
-    // diff
-    stream << traj.pos_ned(0, index)-pos_telem_ned.x() << "," << traj.pos_ned(1, index)-pos_telem_ned.y() << "," << traj.pos_ned(2, index)-pos_telem_ned.z() << ","
-           << traj.vel_ned(0, index)-vel_telem_ned.x() << "," << traj.vel_ned(1, index)-vel_telem_ned.y() << "," << traj.vel_ned(2, index)-vel_telem_ned.z() << ","
-           << traj.accl_ned(0, index)-accl_telem_ned.x() << "," << traj.accl_ned(1, index)-accl_telem_ned.y() << "," << traj.accl_ned(2, index)-accl_telem_ned.z();
+    DroneState telem = staged_drone->getState();
+    QVector3D telem_ned[3] = { guiXyzToNED(telem.pos),
+                               guiXyzToNED(telem.vel),
+                               guiXyzToNED(telem.accel) };
+    for (QVector3D const &ned : telem_ned) {
+        *value++ = ned.x();
+        *value++ = ned.y();
+        *value++ = ned.z();
+    }
 
-    stream << endl;
+    // dropped if writer falls behind, never blocks ticks
+    this->flight_recorder_->record(record);
 }
 
 void Controller::stageTraj() {
     // stage current traj if not currently tracking executed traj and if
     // current traj is feasible
-    if (!this->freeze_traj_timer_->isActive() &&
+    if (!this->reference_clock_->isRunning() &&
             this->model_->getIsValidTraj() == FEASIBILITY_CODE::FEASIBLE) {
         this->setStagedPath();
     }
@@ -716,11 +831,110 @@ void Controller::stageTraj() {
 
 void Controller::unstageTraj() {
     // unstage staged traj if not tracking executed traj
-    if (!this->freeze_traj_timer_->isActive()) {
+    if (!this->reference_clock_->isRunning()) {
         this->unsetStagedPath();
     }
 }
 
+void Controller::generateCandidates() {
+    // need current drone with target and not tracking sent traj
+    DroneModelItem *drone = this->model_->getCurrDrone();
+    if (drone == nullptr || this->model_->isLiveReference()) {
+        return;
+    }
+    QMap<DroneModelItem *, SolverContext *>::iterator iter =
+            this->solver_contexts_.find(drone);
+    if (iter == this->solver_contexts_.end()) {
+        return;
+    }
+    PointModelItem *target = (*iter)->getTarget();
+    if (target == nullptr) {
+        return;
+    }
+
+    // initial state and final pos in meters
+    DroneState state = drone->getState();
+    QVector3D r_i = guiXyzToXyz(state.pos);
+    r_i.setZ(0);
+    QVector3D v_i = guiXyzToXyz(state.vel);
+    QVector3D a_i = guiXyzToXyz(state.accel);
+    QPointF final_pos = target->getPos();
+    QVector3D r_f = guiXyzToXyz(final_pos.x(), final_pos.y(), 0);
+
+    // include edits not yet flushed
+    this->model_->publishSnapshot();
+    this->candidate_generator_->generate(drone, this->model_->getSnapshot(),
+                                         r_i, v_i, a_i, r_f);
+}
+
+void Controller::showCandidates() {
+    this->clearCandidates();
+
+    // drone may have been removed while solving
+    DroneModelItem *drone = this->candidate_generator_->getDrone();
+    if (!this->solver_contexts_.contains(drone)) {
+        return;
+    }
+    this->candidate_drone_ = drone;
+
+    // render top ranked candidates
+    QVector<Candidate> ranked = this->candidate_generator_->getCandidates();
+    for (int i = 0; i < ranked.size() && i < NUM_SHOWN_CANDIDATES; i++) {
+        Candidate const &candidate = ranked.at(i);
+        CandidateGraphicsItem *item_graphic =
+                new CandidateGraphicsItem(candidate.points, i,
+                                          candidate.is_feasible);
+        item_graphic->setToolTip(
+                    QString("%1\nfinal time: %2 s\npeak accel: %3 m/s^2%4")
+                    .arg(candidate.label)
+                    .arg(candidate.final_time, 0, 'f', 2)
+                    .arg(candidate.peak_accel, 0, 'f', 2)
+                    .arg(candidate.is_feasible ? "" : "\ninfeasible"));
+        item_graphic->setZValue(this->candidate_render_level_);
+        this->canvas_->addItem(item_graphic);
+        this->canvas_->candidate_graphics_.append(item_graphic);
+        this->candidates_.append(candidate);
+    }
+}
+
+void Controller::selectCandidate(CandidateGraphicsItem *item) {
+    int rank = this->canvas_->candidate_graphics_.indexOf(item);
+    if (rank < 0) {
+        return;
+    }
+    Candidate const &candidate = this->candidates_.at(rank);
+
+    // stage if not tracking executed traj and candidate is feasible
+    if (this->reference_clock_->isRunning() || !candidate.is_feasible) {
+        return;
+    }
+    TrajectoryFrame frame;
+    frame.points = candidate.points;
+    frame.traj2dof = candidate.traj2dof;
+    frame.is_feasible = candidate.is_feasible;
+    this->model_->stageTraj(this->candidate_drone_, frame);
+    // staged traj is executed at its own final time
+    this->setFinaltime(candidate.final_time);
+    emit this->finalTime(candidate.final_time);
+
+    this->setStagedDrone(this->model_->getStagedDrone());
+    this->canvas_->path_staged_graphic_->setColor(GREEN);
+    // re-render staged traj
+    this->canvas_->path_staged_graphic_->updateGeometry();
+    this->canvas_->path_staged_graphic_->update(
+                this->canvas_->path_staged_graphic_->boundingRect());
+}
+
+void Controller::clearCandidates() {
+    for (CandidateGraphicsItem *item : this->canvas_->candidate_graphics_) {
+        this->canvas_->removeItem(item);
+        delete item;
+    }
+    this->canvas_->candidate_graphics_.clear();
+    this->candidates_.clear();
+    this->candidate_drone_ = nullptr;
+}
+
 void Controller::setSimulated(bool state) {
     // flag to simulate traj instead of sending to vehicle
     this->is_simulated_ = state;
@@ -735,6 +949,14 @@ void Controller::setTrajLock(bool state) {
     this->traj_lock_ = state;
 }
 
+void Controller::setMpcMode(bool state) {
+    this->model_->setMpcMode(state);
+    // resume or pause solves for a trajectory already executing
+    if (this->reference_clock_->isRunning()) {
+        this->model_->setLiveReferenceMode(this->traj_lock_ || state);
+    }
+}
+
 void Controller::setFreeFinalTime(bool state) {
     // TODO(dtsull16): reset inputs?
     this->model_->setFreeFinalTime(state);
@@ -742,10 +964,8 @@ void Controller::setFreeFinalTime(bool state) {
 
 void Controller::setDataCapture(bool state) {
     // close current output file when switching modes
-    if (state != this->capture_data_ && this->output_file_ != nullptr) {
-        this->output_file_->close();
-        delete this->output_file_;
-        this->output_file_ = nullptr;
+    if (state != this->capture_data_) {
+        this->flight_recorder_->close();
     }
     // set state
     this->capture_data_ = state;
@@ -806,197 +1026,133 @@ void Controller::loadFile() {
     
 }
 
+// ============ SESSION CONTROLS ============
+
+bool Controller::setSessionRecording(bool state) {
+    if (!state) {
+        this->session_recorder_->close();
+        return true;
+    }
+    // create file in same directory as executable, closes old one
+    QString filename = QDate::currentDate().toString("'session_'MM_dd_yyyy'");
+    filename.append(QTime::currentTime().toString("'_'hh.mm.ss'.session'"));
+    return this->session_recorder_->open(filename);
+}
+
+void Controller::recordEdit(SessionEvent::EDIT_TYPE edit, double value) {
+    this->session_recorder_->recordEdit(edit, value);
+}
+
+bool Controller::startReplay(QString const &filename, bool is_fast) {
+    // route played datagrams to items of current config
+    this->startSockets();
+    return this->session_replay_->startReplay(filename, is_fast);
+}
+
+void Controller::stopReplay() {
+    this->session_replay_->stopReplay();
+}
+
+QString Controller::getReplayError() {
+    return this->session_replay_->getError();
+}
+
+void Controller::applyEdit(int edit, double value) {
+    switch (edit) {
+        case SessionEvent::EXECUTE_EDIT: {
+            this->execute();
+            break;
+        }
+        case SessionEvent::STAGE_EDIT: {
+            this->stageTraj();
+            break;
+        }
+        case SessionEvent::UNSTAGE_EDIT: {
+            this->unstageTraj();
+            break;
+        }
+        case SessionEvent::FINAL_TIME_EDIT: {
+            // set final time and show it in spin box
+            this->setFinaltime(value);
+            emit this->finalTime(value);
+            break;
+        }
+        case SessionEvent::FREE_FINAL_TIME_EDIT: {
+            this->setFreeFinalTime(value != 0);
+            break;
+        }
+        case SessionEvent::TRAJ_LOCK_EDIT: {
+            this->setTrajLock(value != 0);
+            break;
+        }
+        case SessionEvent::MPC_EDIT: {
+            this->setMpcMode(value != 0);
+            break;
+        }
+        case SessionEvent::SIMULATED_EDIT: {
+            this->setSimulated(value != 0);
+            break;
+        }
+    }
+}
+
 // ============ NETWORK CONTROLS ============
 
 void Controller::startSockets() {
     // close old sockets
     this->closeSockets();
 
-    // create drone sockets
+    // create drone uplinks and telemetry routes
     for (DroneGraphicsItem *graphic : this->canvas_->drone_graphics_) {
         if (graphic->model_->port_ > 0) {
-            DroneSocket *temp = new DroneSocket(graphic);
-            connect(this,
-                    SIGNAL(trajectoryExecuted(DroneModelItem *,
-                                             const autogen::packet::traj2dof)),
-                    temp,
-                    SLOT(rx_trajectory(DroneModelItem *,
-                                       const autogen::packet::traj2dof)));
-            connect(temp, SIGNAL(refresh_graphics()),
-                    this->canvas_, SLOT(update()));
-            this->drone_sockets_.append(temp);
+            this->trajectory_uplink_->addDrone(graphic->model_);
+            this->network_ingest_->addDrone(graphic);
         }
     }
 
-    // create final pos sockets
+    // create final pos routes
     for (PointGraphicsItem *graphic : this->canvas_->final_points_) {
         if (graphic->model_->port_ > 0) {
-            PointSocket *temp = new PointSocket(graphic);
-            connect(temp, SIGNAL(refresh_graphics()),
-                    this->canvas_, SLOT(update()));
-            this->final_point_sockets_.append(temp);
+            this->network_ingest_->addPoint(graphic, graphic->model_);
         }
     }
 
-    // create waypoint sockets
+    // create waypoint routes
     for (WaypointGraphicsItem *graphic : this->canvas_->waypoint_graphics_) {
         if (graphic->model_->port_ > 0) {
-            WaypointSocket *temp = new WaypointSocket(graphic);
-            connect(temp, SIGNAL(refresh_graphics()),
-                    this->canvas_, SLOT(update()));
-            this->waypoint_sockets_.append(temp);
+            this->network_ingest_->addPoint(graphic, graphic->model_);
         }
     }
 
-    // create ellipse sockets
+    // create ellipse routes
     for (EllipseGraphicsItem *graphic : this->canvas_->ellipse_graphics_) {
         if (graphic->model_->port_ > 0) {
-            EllipseSocket *temp = new EllipseSocket(graphic);
-            connect(temp, SIGNAL(refresh_graphics()),
-                    this->canvas_, SLOT(update()));
-            this->ellipse_sockets_.append(temp);
+            this->network_ingest_->addEllipse(graphic);
         }
     }
 
-    // create cylinder sockets
+    // create cylinder routes
     for (CylinderGraphicsItem *graphic : this->canvas_->cylinder_graphics_) {
         if (graphic->model_->port_ > 0) {
-            CylinderSocket *temp = new CylinderSocket(graphic);
-            connect(temp, SIGNAL(refresh_graphics()),
-                    this->canvas_, SLOT(update()));
-            this->cylinder_sockets_.append(temp);
-        }
-    }
-}
-
-void Controller::closeSockets() {
-    // close drone sockets
-    for (DroneSocket *socket : this->drone_sockets_) {
-        delete socket;
-    }
-    this->drone_sockets_.clear();
-
-    // close final point sockets
-    for (PointSocket *socket : this->final_point_sockets_) {
-        delete socket;
-    }
-    this->final_point_sockets_.clear();
-
-    // close waypoint sockets
-    for (WaypointSocket *socket : this->waypoint_sockets_) {
-        delete socket;
-    }
-    this->waypoint_sockets_.clear();
-
-    // close ellipse sockets
-    for (EllipseSocket *socket : this->ellipse_sockets_) {
-        delete socket;
-    }
-    this->ellipse_sockets_.clear();
-
-    // close cylinder sockets
-    for (CylinderSocket *socket : this->cylinder_sockets_) {
-        delete socket;
-    }
-    this->cylinder_sockets_.clear();
-}
-
-void Controller::removeEllipseSocket(EllipseModelItem *model) {
-    // search for socket for given data model and delete it if
-    // it exists
-    int index = 0;
-    bool found = false;
-
-    for (EllipseSocket *socket : this->ellipse_sockets_) {
-        if (socket->ellipse_item_->model_ == model) {
-            delete socket;
-            found = true;
-            break;
+            this->network_ingest_->addCylinder(graphic);
         }
-        index++;
     }
 
-    if (found) {
-        this->ellipse_sockets_.removeAt(index);
-    }
+    // receive all telemetry on ingest thread
+    this->network_ingest_->startIngest();
 }
 
-void Controller::removeCylinderSocket(CylinderModelItem *model) {
-    // search for socket for given data model and delete it if
-    // it exists
-    int index = 0;
-    bool found = false;
-
-    for (CylinderSocket *socket : this->cylinder_sockets_) {
-        if (socket->cylinder_item_->model_ == model) {
-            delete socket;
-            found = true;
-            break;
-        }
-        index++;
-    }
-
-    if (found) {
-        this->cylinder_sockets_.removeAt(index);
-    }
-}
-
-void Controller::removePointSocket(PointModelItem *model) {
-    // search for socket for given data model and delete it if
-    // it exists
-    int index = 0;
-    bool found = false;
-
-    for (PointSocket *socket : this->final_point_sockets_) {
-        if (socket->point_item_->model_ == model) {
-            delete socket;
-            found = true;
-            break;
-        }
-        index++;
-    }
-
-    if (found) {
-        this->final_point_sockets_.removeAt(index);
-    }
-}
-
-void Controller::removeDroneSocket(DroneModelItem *model) {
-    int index = 0;
-    bool found = false;
+void Controller::closeSockets() {
+    // replay injects into routes, stop it before they are cleared
+    this->session_replay_->stopReplay();
 
-    for (DroneSocket *socket : this->drone_sockets_) {
-        if (socket->drone_item_->model_ == model) {
-            delete socket;
-            found = true;
-            break;
-        }
-        index++;
-    }
+    // stop telemetry, waits for receive loop to exit
+    this->network_ingest_->stopIngest();
+    this->network_ingest_->wait();
+    this->network_ingest_->clearRoutes();
 
-    if (found) {
-        this->drone_sockets_.removeAt(index);
-    }
-}
-
-void Controller::removeWaypointSocket(PointModelItem *model) {
-    // search for socket for given data model and delete it if
-    // it exists
-    int index = 0;
-    bool found = false;
-
-    for (WaypointSocket *socket : this->waypoint_sockets_) {
-        if (socket->waypoint_item_->model_ == model) {
-            delete socket;
-            found = true;
-            break;
-        }
-        index++;
-    }
-
-    if (found) {
-        this->waypoint_sockets_.removeAt(index);
-    }
+    // drop drone uplinks
+    this->trajectory_uplink_->clearDrones();
 }
 
 // ============ LOAD CONTROLS ============
@@ -1096,27 +1252,26 @@ void Controller::loadDrone(DroneModelItem *item_model) {
     this->canvas_->path_graphics_.insert(path_graphic_);
     this->canvas_->addItem(path_graphic_);
 
-    // create compute thread
-    ComputeThread *compute_thread_ =
-            new ComputeThread(this->model_, item_graphic, path_graphic_);
-    this->compute_threads_.insert(item_model, compute_thread_);
-    connect(compute_thread_,
+    // create solver context, solved by scheduler's compute threads
+    SolverContext *solver_context =
+            new SolverContext(this->model_, item_graphic, path_graphic_);
+    this->solver_contexts_.insert(item_model, solver_context);
+    connect(solver_context,
             SIGNAL(updateGraphics(PathGraphicsItem *, DroneGraphicsItem *)),
             this->canvas_,
             SLOT(updateGraphicsItems(PathGraphicsItem *, DroneGraphicsItem *)));
-    connect(compute_thread_,
+    connect(solver_context,
             SIGNAL(finalTime(DroneModelItem *, qreal)),
             this,
             SLOT(finalTime(DroneModelItem *, qreal)));
-    connect(compute_thread_,
+    connect(solver_context,
             SIGNAL(updateMessage(DroneModelItem *)),
             this,
             SLOT(updateMessage(DroneModelItem *)));
-    connect(compute_thread_,
-            SIGNAL(finished()),
-            compute_thread_,
-            SLOT(deleteLater()));
-    compute_thread_->start();
+    solver_context->setReplanRate(this->replan_rate_);
+    solver_context->setDeadline(this->deadline_);
+    solver_context->setAnytimeBudget(this->anytime_budget_);
+    this->solver_scheduler_->addContext(solver_context);
 }
 
 void Controller::loadWaypoint(PointModelItem *item_model) {
@@ -1134,8 +1289,8 @@ void Controller::loadWaypoint(PointModelItem *item_model) {
     item_graphic->update(item_graphic->boundingRect());
 
     // update all traj's with new waypoint
-    for (ComputeThread *thread : this->compute_threads_) {
-        thread->reInit();
+    for (SolverContext *context : this->solver_contexts_) {
+        context->reInit();
     }
 }
 
@@ -1146,13 +1301,52 @@ quint32 Controller::getNumWaypoints() {
 
 void Controller::setClearance(qreal clearance) {
     this->model_->setClearance(clearance);
+    // ellipse areas include clearance
+    this->canvas_->updateGeometry();
+}
+
+void Controller::setSpatialIndex(bool is_indexed) {
+    this->canvas_->setIndexed(is_indexed);
+}
+
+void Controller::setReplanRate(qreal rate) {
+    DroneModelItem *drone = this->model_->getCurrDrone();
+    if (drone == nullptr) {
+        this->replan_rate_ = rate;
+    }
+    for (SolverContext *context : this->solver_contexts_) {
+        if (drone == nullptr ||
+                context->getDroneGraphic()->model_ == drone) {
+            context->setReplanRate(rate);
+        }
+    }
+}
+
+void Controller::setDeadline(qreal deadline) {
+    DroneModelItem *drone = this->model_->getCurrDrone();
+    if (drone == nullptr) {
+        this->deadline_ = deadline;
+    }
+    for (SolverContext *context : this->solver_contexts_) {
+        if (drone == nullptr ||
+                context->getDroneGraphic()->model_ == drone) {
+            context->setDeadline(deadline);
+        }
+    }
+}
+
+void Controller::setAnytimeBudget(qreal budget) {
+    this->anytime_budget_ = budget;
+    for (SolverContext *context : this->solver_contexts_) {
+        context->setAnytimeBudget(budget);
+    }
 }
 
 void Controller::setCurrFinalPoint(PointModelItem *point) {
     if (this->model_->getCurrDrone()) {
-        QMap<DroneModelItem *, ComputeThread *>::iterator iter =
-                this->compute_threads_.find(this->model_->getCurrDrone());
-        if (iter != this->compute_threads_.end()) {
+        QMap<DroneModelItem *, SolverContext *>::iterator iter =
+                this->solver_contexts_.find(this->model_->getCurrDrone());
+        if (iter != this->solver_contexts_.end()) {
             (*iter)->setTarget(point);
         }
     }
@@ -1183,4 +1377,167 @@ INPUT_CODE Controller::getIsValidInput() {
     return this->model_->getIsValidInput();
 }
 
+// ============ SOLVER STATS ============
+QList<DroneModelItem *> Controller::getStatsDrones() {
+    // map keys are in pointer order, which stays fixed while the
+    // drones exist, sort by port keeping that order for ties
+    QList<DroneModelItem *> drones = this->solver_contexts_.keys();
+    std::stable_sort(drones.begin(), drones.end(),
+                     [](DroneModelItem *a, DroneModelItem *b) {
+        return a->port_ < b->port_;
+    });
+    return drones;
+}
+
+QString Controller::getSolverStatsText() {
+    QString text;
+    QTextStream stream(&text);
+    stream.setRealNumberNotation(QTextStream::FixedNotation);
+    stream.setRealNumberPrecision(1);
+
+    stream << this->repaint_coalescer_->takeStatsText();
+    stream << this->network_ingest_->takeStatsText();
+    stream << this->trajectory_uplink_->takeStatsText();
+    stream << this->reference_clock_->takeStatsText();
+    stream << this->session_replay_->takeStatsText();
+    stream << "pool " << this->solver_scheduler_->getNumThreads()
+           << " threads " << this->solver_scheduler_->getIdleWakeups()
+           << " idle wakeups" << endl;
+    if (this->model_->isMpc()) {
+        stream << "mpc " << this->splices_ << " splices "
+               << this->splices_rejected_ << " rejected" << endl;
+    }
+    if (this->session_recorder_->getDropped() > 0) {
+        stream << "session " << this->session_recorder_->getDropped()
+               << " dropped" << endl;
+    }
+    if (this->flight_recorder_->getDropped() > 0) {
+        stream << "flight log " << this->flight_recorder_->getDropped()
+               << " dropped" << endl;
+    }
+
+    QList<DroneModelItem *> drones = this->getStatsDrones();
+    for (int i = 0; i < drones.size(); i++) {
+        DroneModelItem *drone = drones.at(i);
+        SolverContext *context = this->solver_contexts_.value(drone);
+        if (context == nullptr) {
+            continue;
+        }
+        SolverStats *stats = context->getStats();
+
+        stream << "drone " << i << " port " << drone->port_ << ": "
+               << stats->takeSolveRate()
+               << " solves/s" << endl;
+        stream << "stage     p50   p99   max (us)" << endl;
+        for (int stage = 0; stage < SolverStats::NUM_STAGES; stage++) {
+            Histogram const &latency = stats->getLatency(
+                        static_cast<SolverStats::STAGE>(stage));
+            stream << qSetFieldWidth(8) << left
+                   << SolverStats::getStageName(
+                          static_cast<SolverStats::STAGE>(stage))
+                   << qSetFieldWidth(6) << right
+                   << latency.getPercentile(0.5)
+                   << latency.getPercentile(0.99)
+                   << latency.getMax()
+                   << qSetFieldWidth(0) << left << endl;
+        }
+        stream << "passes to settle p50 "
+               << stats->getIterations().getPercentile(0.5) << endl;
+        stream << "warm " << context->getNumStarts(true) << " starts "
+               << context->getMeanPassesToConverge(true) << " passes"
+               << endl;
+        stream << "cold " << context->getNumStarts(false) << " starts "
+               << context->getMeanPassesToConverge(false) << " passes"
+               << endl;
+        stream << "dropped " << context->getResultsDropped()
+               << " late " << context->getDeadlineMisses() << endl;
+    }
+    return text;
+}
+
+void Controller::recordPaint(QRegion const &region) {
+    this->repaint_coalescer_->recordPaint(region);
+}
+
+bool Controller::dumpSolverStats(QString const &filename) {
+    QFile file(filename);
+    if (!file.open(QIODevice::WriteOnly | QIODevice::Text)) {
+        return false;
+    }
+    QTextStream stream(&file);
+    QList<DroneModelItem *> drones = this->getStatsDrones();
+
+    // summary, latency in microseconds and iterations in passes
+    stream << "drone,stage,count,mean,p50,p90,p99,p999,max" << endl;
+    for (int i = 0; i < drones.size(); i++) {
+        DroneModelItem *drone = drones.at(i);
+        SolverContext *context = this->solver_contexts_.value(drone);
+        if (context == nullptr) {
+            continue;
+        }
+        SolverStats *stats = context->getStats();
+
+        for (int stage = 0; stage <= SolverStats::NUM_STAGES; stage++) {
+            // extra row for iterations after latency stages
+            bool is_iterations = stage == SolverStats::NUM_STAGES;
+            Histogram const &hist = is_iterations ?
+                        stats->getIterations() :
+                        stats->getLatency(
+                            static_cast<SolverStats::STAGE>(stage));
+            QString name = is_iterations ? "iterations" :
+                        SolverStats::getStageName(
+                            static_cast<SolverStats::STAGE>(stage));
+            stream << i << "," << name << ","
+                   << hist.getCount() << "," << hist.getMean() << ","
+                   << hist.getPercentile(0.5) << ","
+                   << hist.getPercentile(0.9) << ","
+                   << hist.getPercentile(0.99) << ","
+                   << hist.getPercentile(0.999) << ","
+                   << hist.getMax() << endl;
+        }
+    }
+
+    // raw buckets to merge or replot runs
+    stream << endl << "drone,stage,low,high,count" << endl;
+    for (int i = 0; i < drones.size(); i++) {
+        DroneModelItem *drone = drones.at(i);
+        SolverContext *context = this->solver_contexts_.value(drone);
+        if (context == nullptr) {
+            continue;
+        }
+        SolverStats *stats = context->getStats();
+
+        for (int stage = 0; stage < SolverStats::NUM_STAGES; stage++) {
+            SolverStats::STAGE s = static_cast<SolverStats::STAGE>(stage);
+            stats->getLatency(s).writeBuckets(
+                        &stream, QString("%1,%2").arg(i)
+                        .arg(SolverStats::getStageName(s)));
+        }
+        stats->getIterations().writeBuckets(
+                    &stream, QString("%1,iterations").arg(i));
+    }
+
+    // warm and cold starts, mean passes until settled
+    stream << endl << "drone,start,count,mean_passes" << endl;
+    for (int i = 0; i < drones.size(); i++) {
+        DroneModelItem *drone = drones.at(i);
+        SolverContext *context = this->solver_contexts_.value(drone);
+        if (context == nullptr) {
+            continue;
+        }
+        stream << i << ",warm," << context->getNumStarts(true) << ","
+               << context->getMeanPassesToConverge(true) << endl;
+        stream << i << ",cold," << context->getNumStarts(false) << ","
+               << context->getMeanPassesToConverge(false) << endl;
+    }
+
+    // compute pool, idle wakeups since start
+    stream << endl << "threads,idle_wakeups" << endl;
+    stream << this->solver_scheduler_->getNumThreads() << ","
+           << this->solver_scheduler_->getIdleWakeups() << endl;
+
+    file.close();
+    return true;
+}
+
 }  // namespace optgui
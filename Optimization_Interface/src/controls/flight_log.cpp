@@ -0,0 +1,146 @@
+// TITLE:   Optimization_Interface/src/controls/flight_log.cpp
+// AUTHORS: Daniel Sullivan
+// LAB:     Autonomous Controls Lab (ACL)
+// LICENSE: Copyright 2020, All Rights Reserved
+
+#include "include/controls/flight_log.h"
+
+#include <cstring>
+
+namespace optgui {
+
+QStringList FlightLogWriter::getColumns() {
+    return QStringList() << "abs_time" << "rel_time"
+
+                         << "pos_ref_n" << "pos_ref_e" << "pos_ref_d"
+                         << "vel_ref_n" << "vel_ref_e" << "vel_ref_d"
+                         << "accl_ref_n" << "accl_ref_e" << "accl_ref_d"
+
+                         << "pos_telem_n" << "pos_telem_e" << "pos_telem_d"
+                         << "vel_telem_n" << "vel_telem_e" << "vel_telem_d"
+                         << "accl_telem_n" << "accl_telem_e"
+                         << "accl_telem_d";
+}
+
+bool FlightLogWriter::open(QIODevice *device) {
+    this->stream_.setDevice(device);
+    this->stream_.setByteOrder(QDataStream::LittleEndian);
+    this->stream_.setFloatingPointPrecision(QDataStream::DoublePrecision);
+
+    QStringList columns = getColumns();
+    this->stream_ << MAGIC << VERSION << quint32(columns.size());
+    for (int i = 0; i < columns.size(); i++) {
+        quint8 type = i == 0 ? INT64_COLUMN : FLOAT64_COLUMN;
+        this->stream_ << columns.at(i).toUtf8() << type;
+    }
+    return this->stream_.status() == QDataStream::Ok;
+}
+
+bool FlightLogWriter::writeBlock(QVector<FlightRecord> const &records) {
+    this->stream_ << quint32(records.size());
+    // all rows of each column together
+    for (FlightRecord const &record : records) {
+        this->stream_ << record.abs_time;
+    }
+    for (int i = 0; i < FlightRecord::NUM_VALUES; i++) {
+        for (FlightRecord const &record : records) {
+            this->stream_ << record.values[i];
+        }
+    }
+    return this->stream_.status() == QDataStream::Ok;
+}
+
+bool FlightLogReader::open(QIODevice *device) {
+    this->stream_.setDevice(device);
+    this->stream_.setByteOrder(QDataStream::LittleEndian);
+    this->stream_.setFloatingPointPrecision(QDataStream::DoublePrecision);
+    this->columns_.clear();
+
+    quint32 magic = 0;
+    quint32 version = 0;
+    quint32 num_columns = 0;
+    this->stream_ >> magic >> version >> num_columns;
+    if (this->stream_.status() != QDataStream::Ok ||
+            magic != FlightLogWriter::MAGIC) {
+        this->error_ = "not a flight log";
+        return false;
+    }
+    if (version > FlightLogWriter::VERSION) {
+        this->error_ = QString("unsupported version %1").arg(version);
+        return false;
+    }
+
+    QStringList names = FlightLogWriter::getColumns();
+    for (quint32 i = 0; i < num_columns; i++) {
+        QByteArray name;
+        Column column;
+        this->stream_ >> name >> column.type;
+        if (column.type != FlightLogWriter::INT64_COLUMN &&
+                column.type != FlightLogWriter::FLOAT64_COLUMN) {
+            this->error_ = QString("unknown type of column %1")
+                    .arg(QString::fromUtf8(name));
+            return false;
+        }
+        // first name is abs_time, others are offset by one
+        int index = names.indexOf(QString::fromUtf8(name));
+        column.index = index < 0 ? UNKNOWN_INDEX : index - 1;
+        this->columns_.append(column);
+    }
+
+    if (this->stream_.status() != QDataStream::Ok) {
+        this->error_ = "truncated header";
+        return false;
+    }
+    return true;
+}
+
+bool FlightLogReader::readBlock(QVector<FlightRecord> *records) {
+    if (this->stream_.atEnd()) {
+        return false;
+    }
+    quint32 rows = 0;
+    this->stream_ >> rows;
+    // never size records from a corrupt count
+    if (this->stream_.status() != QDataStream::Ok) {
+        this->error_ = "truncated block";
+        return false;
+    }
+    if (rows > quint32(FlightLogWriter::MAX_BLOCK_ROWS)) {
+        this->error_ = QString("corrupt block of %1 rows").arg(rows);
+        return false;
+    }
+    records->resize(rows);
+    std::memset(records->data(), 0, rows * sizeof(FlightRecord));
+
+    for (Column const &column : this->columns_) {
+        for (quint32 row = 0; row < rows; row++) {
+            double value = 0;
+            if (column.type == FlightLogWriter::INT64_COLUMN) {
+                qint64 int_value = 0;
+                this->stream_ >> int_value;
+                value = int_value;
+                if (column.index == ABS_TIME_INDEX) {
+                    (*records)[row].abs_time = int_value;
+                    continue;
+                }
+            } else {
+                this->stream_ >> value;
+            }
+            if (column.index >= 0) {
+                (*records)[row].values[column.index] = value;
+            }
+        }
+    }
+
+    if (this->stream_.status() != QDataStream::Ok) {
+        this->error_ = "truncated block";
+        return false;
+    }
+    return true;
+}
+
+QString FlightLogReader::getError() {
+    return this->error_;
+}
+
+}  // namespace optgui
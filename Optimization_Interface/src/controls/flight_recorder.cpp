@@ -0,0 +1,126 @@
+// TITLE:   Optimization_Interface/src/controls/flight_recorder.cpp
+// AUTHORS: Daniel Sullivan
+// LAB:     Autonomous Controls Lab (ACL)
+// LICENSE: Copyright 2020, All Rights Reserved
+
+#include "include/controls/flight_recorder.h"
+
+namespace optgui {
+
+FlightRecorder::FlightRecorder() : mutex_(), stop_() {
+    this->file_ = nullptr;
+    // one slot stays empty to tell full from empty
+    this->queue_.resize(QUEUE_SIZE);
+    this->block_.reserve(BLOCK_ROWS);
+    this->head_ = 0;
+    this->tail_ = 0;
+    this->dropped_ = 0;
+    this->run_loop_ = false;
+}
+
+FlightRecorder::~FlightRecorder() {
+    this->close();
+}
+
+bool FlightRecorder::open(QString const &filename) {
+    this->close();
+
+    this->file_ = new QFile(filename);
+    if (!this->file_->open(QIODevice::WriteOnly) ||
+            !this->writer_.open(this->file_)) {
+        delete this->file_;
+        this->file_ = nullptr;
+        return false;
+    }
+
+    this->head_ = 0;
+    this->tail_ = 0;
+    this->dropped_ = 0;
+    this->block_.resize(0);
+
+    QMutexLocker locker(&this->mutex_);
+    this->run_loop_ = true;
+    locker.unlock();
+    this->start();
+    return true;
+}
+
+void FlightRecorder::close() {
+    if (this->file_ == nullptr) {
+        return;
+    }
+    // flag loop to stop and wake writer, it drains queue before
+    // exiting
+    QMutexLocker locker(&this->mutex_);
+    this->run_loop_ = false;
+    this->stop_.wakeOne();
+    locker.unlock();
+    this->wait();
+
+    this->file_->close();
+    delete this->file_;
+    this->file_ = nullptr;
+}
+
+bool FlightRecorder::isOpen() {
+    return this->file_ != nullptr;
+}
+
+bool FlightRecorder::record(FlightRecord const &record) {
+    if (this->file_ == nullptr) {
+        return false;
+    }
+    int head = this->head_.load();
+    int next = (head + 1) % QUEUE_SIZE;
+    if (next == this->tail_.loadAcquire()) {
+        this->dropped_++;
+        return false;
+    }
+    this->queue_[head] = record;
+    // publish slot to writer
+    this->head_.storeRelease(next);
+    return true;
+}
+
+quint64 FlightRecorder::getDropped() {
+    return this->dropped_.load();
+}
+
+void FlightRecorder::run() {
+    QMutexLocker locker(&this->mutex_);
+    while (this->run_loop_) {
+        locker.unlock();
+        this->drainQueue();
+        locker.relock();
+        // flag checked under lock so a close is never missed
+        if (this->run_loop_) {
+            this->stop_.wait(&this->mutex_, WRITE_INTERVAL_MS);
+        }
+    }
+    locker.unlock();
+
+    // records queued before close, then last partial block
+    this->drainQueue();
+    if (!this->block_.isEmpty()) {
+        this->writer_.writeBlock(this->block_);
+        this->block_.resize(0);
+    }
+    this->file_->flush();
+}
+
+void FlightRecorder::drainQueue() {
+    int tail = this->tail_.load();
+    int head = this->head_.loadAcquire();
+    while (tail != head) {
+        this->block_.append(this->queue_.at(tail));
+        tail = (tail + 1) % QUEUE_SIZE;
+        if (this->block_.size() == BLOCK_ROWS) {
+            this->writer_.writeBlock(this->block_);
+            this->block_.resize(0);
+        }
+    }
+    // hand slots back to GUI thread
+    this->tail_.storeRelease(tail);
+}
+
+}  // namespace optgui
@@ -0,0 +1,162 @@
+// TITLE:   Optimization_Interface/src/controls/reference_clock.cpp
+// AUTHORS: Daniel Sullivan
+// LAB:     Autonomous Controls Lab (ACL)
+// LICENSE: Copyright 2020, All Rights Reserved
+
+#include "include/controls/reference_clock.h"
+
+#include <QTextStream>
+
+#include <algorithm>
+
+#include "include/globals.h"
+
+namespace optgui {
+
+ReferenceClock::ReferenceClock() : mutex_(), schedule_changed_() {
+    this->next_ = 0;
+    this->is_pending_ = false;
+    this->ticks_ = 0;
+    this->skipped_ = 0;
+    this->total_late_usec_ = 0;
+    this->max_late_usec_ = 0;
+    this->taken_ = 0;
+    this->total_taken_usec_ = 0;
+    this->max_taken_usec_ = 0;
+    this->run_loop_ = false;
+}
+
+ReferenceClock::~ReferenceClock() {
+    this->stop();
+}
+
+void ReferenceClock::schedule(autogen::packet::traj2dof const &traj,
+                              int size) {
+    QMutexLocker locker(&this->mutex_);
+    this->deadlines_.resize(0);
+    if (size > 0) {
+        qint64 start_usec = getMonotonicUsec();
+        for (int i = 0; i < size; i++) {
+            this->deadlines_.append(start_usec + qRound64(
+                        (traj.time(i) - traj.time(0)) * 1.0e6));
+        }
+        // last node is held for one spacing, as every other node
+        qint64 spacing = size > 1 ? this->deadlines_.at(size - 1) -
+                                    this->deadlines_.at(size - 2) : 0;
+        this->deadlines_.append(this->deadlines_.last() + spacing);
+    }
+    // node 0 is taken by caller, ticks of old schedule are stale
+    this->next_ = 1;
+    this->is_pending_ = false;
+    this->run_loop_ = true;
+    locker.unlock();
+
+    if (this->isRunning()) {
+        this->schedule_changed_.wakeOne();
+    } else {
+        QThread::start(QThread::TimeCriticalPriority);
+    }
+}
+
+void ReferenceClock::stop() {
+    QMutexLocker locker(&this->mutex_);
+    this->run_loop_ = false;
+    locker.unlock();
+    this->schedule_changed_.wakeOne();
+    this->wait();
+}
+
+int ReferenceClock::takeIndex() {
+    QMutexLocker locker(&this->mutex_);
+    this->is_pending_ = false;
+    if (this->deadlines_.isEmpty()) {
+        return 0;
+    }
+    // last deadline passed, nodes between ticks are skipped
+    qint64 now = getMonotonicUsec();
+    int index = std::upper_bound(this->deadlines_.begin(),
+                                 this->deadlines_.end(), now) -
+            this->deadlines_.begin() - 1;
+    index = qMax(0, index);
+
+    qint64 late = now - this->deadlines_.at(index);
+    this->taken_++;
+    this->total_taken_usec_ += late;
+    this->max_taken_usec_ = qMax(this->max_taken_usec_, late);
+    return index;
+}
+
+QString ReferenceClock::takeStatsText() {
+    QMutexLocker locker(&this->mutex_);
+    QString text;
+    if (this->ticks_ == 0) {
+        return text;
+    }
+    QTextStream stream(&text);
+    stream.setRealNumberNotation(QTextStream::FixedNotation);
+    stream.setRealNumberPrecision(1);
+    stream << "clock " << this->ticks_ << " ticks "
+           << this->skipped_ << " skipped "
+           << (qreal(this->total_late_usec_) / this->ticks_)
+           << " us avg " << this->max_late_usec_ << " us max late" << endl;
+    if (this->taken_ > 0) {
+        stream << "clock gui " << (qreal(this->total_taken_usec_) /
+                                   this->taken_)
+               << " us avg " << this->max_taken_usec_
+               << " us max late" << endl;
+    }
+    this->ticks_ = 0;
+    this->skipped_ = 0;
+    this->total_late_usec_ = 0;
+    this->max_late_usec_ = 0;
+    this->taken_ = 0;
+    this->total_taken_usec_ = 0;
+    this->max_taken_usec_ = 0;
+    return text;
+}
+
+void ReferenceClock::run() {
+    QMutexLocker locker(&this->mutex_);
+    while (this->run_loop_) {
+        // schedule ended, wait for stop or a new schedule
+        if (this->next_ >= this->deadlines_.size()) {
+            this->schedule_changed_.wait(&this->mutex_);
+            continue;
+        }
+
+        // deadline may change while waiting, so recheck after
+        qint64 deadline = this->deadlines_.at(this->next_);
+        qint64 remaining = deadline - getMonotonicUsec();
+        if (remaining > SLEEP_USEC) {
+            this->schedule_changed_.wait(
+                        &this->mutex_, (remaining - SLEEP_USEC) / 1000);
+            continue;
+        }
+        if (remaining > 0) {
+            locker.unlock();
+            QThread::usleep(remaining);
+            locker.relock();
+            continue;
+        }
+
+        // signal latest due node, count any passed while late
+        qint64 now = getMonotonicUsec();
+        this->ticks_++;
+        this->total_late_usec_ += now - deadline;
+        this->max_late_usec_ = qMax(this->max_late_usec_, now - deadline);
+        this->next_++;
+        while (this->next_ < this->deadlines_.size() &&
+               this->deadlines_.at(this->next_) <= now) {
+            this->next_++;
+            this->skipped_++;
+        }
+        if (!this->is_pending_) {
+            this->is_pending_ = true;
+            locker.unlock();
+            emit this->tick();
+            locker.relock();
+        }
+    }
+}
+
+}  // namespace optgui
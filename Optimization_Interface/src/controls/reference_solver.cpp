@@ -0,0 +1,157 @@
+// TITLE:   Optimization_Interface/src/controls/reference_solver.cpp
+// AUTHORS: Daniel Sullivan
+// LAB:     Autonomous Controls Lab (ACL)
+// LICENSE: Copyright 2020, All Rights Reserved
+
+#include "include/controls/reference_solver.h"
+
+#include <QVector>
+#include <QtMath>
+
+#include <algorithm>
+
+namespace optgui {
+
+ReferenceSolver::ReferenceSolver() : P_(), O_() {
+    std::fill(this->r_i_, this->r_i_ + 3, 0);
+    std::fill(this->v_i_, this->v_i_ + 3, 0);
+    std::fill(this->r_f_, this->r_f_ + 3, 0);
+    std::fill(&this->wp_[0][0],
+              &this->wp_[0][0] + (skyenet::MAX_WAYPOINTS * 3), 0);
+}
+
+void ReferenceSolver::setParams(skyenet::params &P,
+                                double r_i[3], double v_i[3],
+                                double a_i[3], double r_f[3],
+                                double wp[skyenet::MAX_WAYPOINTS][3]) {
+    // initial accel is not matched by a cubic
+    Q_UNUSED(a_i);
+    this->P_ = P;
+    std::copy(r_i, r_i + 3, this->r_i_);
+    std::copy(v_i, v_i + 3, this->v_i_);
+    std::copy(r_f, r_f + 3, this->r_f_);
+    std::copy(&wp[0][0], &wp[0][0] + (skyenet::MAX_WAYPOINTS * 3),
+              &this->wp_[0][0]);
+}
+
+void ReferenceSolver::resetInputs(double r_i[3], double v_i[3],
+                                  double a_i[3], double r_f[3],
+                                  double wp[skyenet::MAX_WAYPOINTS][3],
+                                  bool free_final_time) {
+    // closed form, no iterate to discard
+    Q_UNUSED(r_i);
+    Q_UNUSED(v_i);
+    Q_UNUSED(a_i);
+    Q_UNUSED(r_f);
+    Q_UNUSED(wp);
+    Q_UNUSED(free_final_time);
+}
+
+skyenet::outputs const &ReferenceSolver::update(bool free_final_time) {
+    quint32 K = this->P_.K;
+    if (K < 2) {
+        return this->O_;
+    }
+    double T = free_final_time ? this->getFreeFinalTime() : this->P_.tf;
+    double dt = T / (K - 1);
+
+    // knots at node indices: initial pos, waypoints, final pos
+    QVector<quint32> knot_idx;
+    QVector<double const *> knot_pos;
+    knot_idx.append(0);
+    knot_pos.append(this->r_i_);
+    for (quint32 i = 0; i < this->P_.n_wp; i++) {
+        quint32 idx = this->P_.wp_idx[i];
+        // skip waypoints out of order or on the ends
+        if (idx > knot_idx.last() && idx < K - 1) {
+            knot_idx.append(idx);
+            knot_pos.append(this->wp_[i]);
+        }
+    }
+    knot_idx.append(K - 1);
+    knot_pos.append(this->r_f_);
+
+    // knot vels, initial vel at start, stopped at end and
+    // finite differences between
+    int n = knot_idx.size();
+    QVector<double> knot_vel(3 * n, 0);
+    for (int j = 0; j < 3; j++) {
+        knot_vel[j] = this->v_i_[j];
+    }
+    for (int m = 1; m < n - 1; m++) {
+        double span = (knot_idx.at(m + 1) - knot_idx.at(m - 1)) * dt;
+        for (int j = 0; j < 3; j++) {
+            knot_vel[(3 * m) + j] =
+                    (knot_pos.at(m + 1)[j] - knot_pos.at(m - 1)[j]) / span;
+        }
+    }
+
+    // sample hermite segments on nodes
+    int m = 0;
+    for (quint32 k = 0; k < K; k++) {
+        while (m < n - 2 && k > knot_idx.at(m + 1)) {
+            m++;
+        }
+        double h = (knot_idx.at(m + 1) - knot_idx.at(m)) * dt;
+        double s = static_cast<double>(k - knot_idx.at(m)) /
+                (knot_idx.at(m + 1) - knot_idx.at(m));
+        double s2 = s * s;
+        double s3 = s2 * s;
+
+        // basis, first and second derivatives in s
+        double h00 = (2 * s3) - (3 * s2) + 1;
+        double h10 = s3 - (2 * s2) + s;
+        double h01 = (-2 * s3) + (3 * s2);
+        double h11 = s3 - s2;
+        double d00 = (6 * s2) - (6 * s);
+        double d10 = (3 * s2) - (4 * s) + 1;
+        double d01 = (-6 * s2) + (6 * s);
+        double d11 = (3 * s2) - (2 * s);
+        double dd00 = (12 * s) - 6;
+        double dd10 = (6 * s) - 4;
+        double dd01 = (-12 * s) + 6;
+        double dd11 = (6 * s) - 2;
+
+        for (int j = 0; j < 3; j++) {
+            double p0 = knot_pos.at(m)[j];
+            double p1 = knot_pos.at(m + 1)[j];
+            double m0 = h * knot_vel.at((3 * m) + j);
+            double m1 = h * knot_vel.at((3 * (m + 1)) + j);
+            this->O_.r[j][k] = (h00 * p0) + (h10 * m0) +
+                               (h01 * p1) + (h11 * m1);
+            this->O_.v[j][k] = ((d00 * p0) + (d10 * m0) +
+                                (d01 * p1) + (d11 * m1)) / h;
+            this->O_.a[j][k] = ((dd00 * p0) + (dd10 * m0) +
+                                (dd01 * p1) + (dd11 * m1)) / (h * h);
+        }
+        this->O_.t[k] = k * dt;
+    }
+
+    // interpolates exactly, nothing relaxed
+    this->O_.T = T;
+    this->O_.dtau = 0;
+    for (int j = 0; j < 3; j++) {
+        this->O_.ri_relax[j] = 0;
+        this->O_.rf_relax[j] = 0;
+    }
+    return this->O_;
+}
+
+double ReferenceSolver::getFreeFinalTime() {
+    // length of polyline through initial pos, waypoints, final pos
+    double length = 0;
+    double const *last = this->r_i_;
+    for (quint32 i = 0; i <= this->P_.n_wp; i++) {
+        double const *next = i < this->P_.n_wp ? this->wp_[i] : this->r_f_;
+        length += qSqrt(qPow(next[0] - last[0], 2) +
+                        qPow(next[1] - last[1], 2) +
+                        qPow(next[2] - last[2], 2));
+        last = next;
+    }
+    if (this->P_.v_max <= 0) {
+        return this->P_.tf;
+    }
+    return qMax(1.0, 2.0 * length / this->P_.v_max);
+}
+
+}  // namespace optgui
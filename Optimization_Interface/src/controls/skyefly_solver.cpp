@@ -0,0 +1,28 @@
+// TITLE:   Optimization_Interface/src/controls/skyefly_solver.cpp
+// AUTHORS: Daniel Sullivan
+// LAB:     Autonomous Controls Lab (ACL)
+// LICENSE: Copyright 2020, All Rights Reserved
+
+#include "include/controls/skyefly_solver.h"
+
+namespace optgui {
+
+void SkyeFlySolver::setParams(skyenet::params &P,
+                              double r_i[3], double v_i[3],
+                              double a_i[3], double r_f[3],
+                              double wp[skyenet::MAX_WAYPOINTS][3]) {
+    this->fly_.setParams(P, r_i, v_i, a_i, r_f, wp);
+}
+
+void SkyeFlySolver::resetInputs(double r_i[3], double v_i[3],
+                                double a_i[3], double r_f[3],
+                                double wp[skyenet::MAX_WAYPOINTS][3],
+                                bool free_final_time) {
+    this->fly_.resetInputs(r_i, v_i, a_i, r_f, wp, free_final_time);
+}
+
+skyenet::outputs const &SkyeFlySolver::update(bool free_final_time) {
+    return this->fly_.update(free_final_time);
+}
+
+}  // namespace optgui
@@ -0,0 +1,725 @@
+// TITLE:   Optimization_Interface/src/controls/solver_context.cpp
+// AUTHORS: Daniel Sullivan
+// LAB:     Autonomous Controls Lab (ACL)
+// LICENSE: Copyright 2020, All Rights Reserved
+
+#include "include/controls/solver_context.h"
+#include "include/graphics/path_graphics_item.h"
+#include "include/controls/solver_outputs.h"
+
+#include <algorithm>
+#include <limits>
+#include <QVector3D>
+#include <QElapsedTimer>
+
+namespace optgui {
+
+SolverContext::SolverContext(ConstraintModel *model,
+                             DroneGraphicsItem *drone,
+                             PathGraphicsItem *traj_graphic) : mutex_() {
+    this->model_ = model;
+    this->drone_ = drone;
+    this->traj_graphic_ = traj_graphic;
+    this->target_ = nullptr;
+    this->target_changed_ = true;
+    this->is_cleared_ = false;
+    this->solves_executed_ = 0;
+    this->solves_skipped_ = 0;
+    // force solve on first pass
+    this->model_version_ = INVALID_VERSION;
+    this->drone_generation_ = INVALID_VERSION;
+    this->target_generation_ = INVALID_VERSION;
+    this->max_refine_passes_ = MAX_REFINE_PASSES;
+    this->refine_passes_ = 0;
+    this->is_converged_ = false;
+    this->horizon_ = 0;
+    this->last_final_time_ = 0;
+    this->is_free_final_time_ = false;
+    this->fly_ = nullptr;
+    this->is_counting_passes_ = false;
+    this->is_warm_start_ = false;
+    this->passes_since_reset_ = 0;
+    this->warm_starts_ = 0;
+    this->warm_start_passes_ = 0;
+    this->cold_starts_ = 0;
+    this->cold_start_passes_ = 0;
+    // ungoverned until rate is set
+    this->period_ = 0;
+    this->deadline_ = 0;
+    this->clock_.start();
+    this->period_start_ = 0;
+    this->solve_estimate_ = 0;
+    this->last_publish_ = 0;
+    this->start_pos_ = QVector3D();
+    this->results_dropped_ = 0;
+    this->deadline_misses_ = 0;
+    this->is_graphics_pending_ = false;
+    this->is_message_pending_ = false;
+    this->is_final_time_pending_ = false;
+    this->pending_final_time_ = 0;
+    this->anytime_budget_ = 0;
+    this->best_relaxation_ = std::numeric_limits<double>::max();
+}
+
+SolverContext::~SolverContext() {
+    QMutexLocker locker(&this->mutex_);
+}
+
+void SolverContext::setTarget(PointModelItem *target) {
+    QMutexLocker locker(&this->mutex_);
+    if (target != this->target_) {
+        this->target_changed_ = true;
+    }
+    this->target_ = target;
+    locker.unlock();
+    // wake compute threads to solve for new target
+    this->model_->notifyChange();
+}
+
+void SolverContext::removeTarget(PointModelItem *target) {
+    QMutexLocker locker(&this->mutex_);
+    if (target == this->target_) {
+        this->target_ = nullptr;
+        this->target_changed_ = true;
+    }
+    locker.unlock();
+    // cache is only used by solving thread, none is solving
+    this->warm_start_cache_.removeTarget(target);
+}
+
+bool SolverContext::takeTargetChanged() {
+    QMutexLocker locker(&this->mutex_);
+    bool target_changed = this->target_changed_;
+    this->target_changed_ = false;
+    return target_changed;
+}
+
+bool SolverContext::isTargetChanged() {
+    QMutexLocker locker(&this->mutex_);
+    return this->target_changed_;
+}
+
+void SolverContext::reInit() {
+    QMutexLocker locker(&this->mutex_);
+    this->target_changed_ = true;
+    locker.unlock();
+    this->model_->notifyChange();
+}
+
+PointModelItem *SolverContext::getTarget() {
+    QMutexLocker locker(&this->mutex_);
+    return this->target_;
+}
+
+PathGraphicsItem *SolverContext::getTrajGraphic() {
+    QMutexLocker locker(&this->mutex_);
+    return this->traj_graphic_;
+}
+
+quint64 SolverContext::getSolvesExecuted() {
+    return this->solves_executed_.load();
+}
+
+quint64 SolverContext::getSolvesSkipped() {
+    return this->solves_skipped_.load();
+}
+
+quint64 SolverContext::getNumStarts(bool is_warm_start) {
+    if (is_warm_start) {
+        return this->warm_starts_.load();
+    }
+    return this->cold_starts_.load();
+}
+
+qreal SolverContext::getMeanPassesToConverge(bool is_warm_start) {
+    quint64 starts = this->getNumStarts(is_warm_start);
+    if (starts == 0) {
+        return 0;
+    }
+    quint64 passes = is_warm_start ? this->warm_start_passes_.load()
+                                   : this->cold_start_passes_.load();
+    return static_cast<qreal>(passes) / starts;
+}
+
+SolverStats *SolverContext::getStats() {
+    return &this->stats_;
+}
+
+void SolverContext::setReplanRate(qreal rate) {
+    QMutexLocker locker(&this->mutex_);
+    this->period_ = rate > 0 ? qRound64(1000000.0 / rate) : 0;
+    locker.unlock();
+    // wake threads waiting on old period
+    this->model_->notifyChange();
+}
+
+qreal SolverContext::getReplanRate() {
+    QMutexLocker locker(&this->mutex_);
+    return this->period_ > 0 ? 1000000.0 / this->period_ : 0;
+}
+
+void SolverContext::setDeadline(qreal deadline) {
+    QMutexLocker locker(&this->mutex_);
+    this->deadline_ = qMax<qint64>(0, qRound64(deadline * 1000.0));
+    locker.unlock();
+    this->model_->notifyChange();
+}
+
+qreal SolverContext::getDeadline() {
+    QMutexLocker locker(&this->mutex_);
+    return this->deadline_ / 1000.0;
+}
+
+void SolverContext::setAnytimeBudget(qreal budget) {
+    QMutexLocker locker(&this->mutex_);
+    this->anytime_budget_ = qMax<qint64>(0, qRound64(budget * 1000.0));
+    // reload params with iterations per update for mode
+    this->target_changed_ = true;
+    locker.unlock();
+    this->model_->notifyChange();
+}
+
+qreal SolverContext::getAnytimeBudget() {
+    QMutexLocker locker(&this->mutex_);
+    return this->anytime_budget_ / 1000.0;
+}
+
+quint64 SolverContext::getResultsDropped() {
+    return this->results_dropped_.load();
+}
+
+quint64 SolverContext::getDeadlineMisses() {
+    return this->deadline_misses_.load();
+}
+
+qint64 SolverContext::getStartDelay() {
+    QMutexLocker locker(&this->mutex_);
+    qint64 period = this->period_;
+    // deadline defaults to end of period, never past it
+    qint64 deadline = this->deadline_ > 0 ?
+                qMin(this->deadline_, period) : period;
+    locker.unlock();
+
+    if (period == 0) {
+        return 0;
+    }
+
+    // skip periods that passed while idle
+    qint64 now = this->clock_.nsecsElapsed() / 1000;
+    if (now > this->period_start_ + deadline) {
+        this->period_start_ = now - ((now - this->period_start_) % period);
+    }
+
+    // start as late as possible so the solve uses the newest
+    // inputs and still finishes by the deadline
+    qint64 estimate = qRound64(this->solve_estimate_ *
+                               SOLVE_ESTIMATE_MARGIN);
+    qint64 start = qMax(this->period_start_,
+                        this->period_start_ + deadline - estimate);
+    return qMax<qint64>(0, start - now);
+}
+
+void SolverContext::finishPeriod(qint64 now) {
+    QMutexLocker locker(&this->mutex_);
+    qint64 period = this->period_;
+    qint64 deadline = this->deadline_ > 0 ?
+                qMin(this->deadline_, period) : period;
+    locker.unlock();
+
+    this->last_publish_ = now;
+    if (period == 0) {
+        return;
+    }
+    if (now > this->period_start_ + deadline) {
+        this->deadline_misses_++;
+    }
+    // next period after the one just solved
+    this->period_start_ += period *
+            (((now - this->period_start_) / period) + 1);
+}
+
+DroneGraphicsItem *SolverContext::getDroneGraphic() {
+    QMutexLocker locker(&this->mutex_);
+    return this->drone_;
+}
+
+bool SolverContext::hasWork() {
+    // Do not compute new trajectories if executing
+    // sent trajectory, unless replanning it in mpc mode
+    if (this->model_->isSolvePaused(this->drone_->model_)) {
+        return false;
+    }
+
+    // only need to clear trajectory if no final point selected
+    PointModelItem *target = this->getTarget();
+    if (target == nullptr) {
+        return !this->is_cleared_;
+    }
+
+    // work if inputs changed or trajectory has not settled
+    if (this->isInputsChanged(target) || (!this->is_converged_
+            && this->refine_passes_ < this->max_refine_passes_)) {
+        return true;
+    }
+    return false;
+}
+
+bool SolverContext::isInputsChanged(PointModelItem *target) {
+    return this->isTargetChanged()
+            || this->model_->getModelVersion() != this->model_version_
+            || this->drone_->model_->getGeneration()
+               != this->drone_generation_
+            || target->getGeneration() != this->target_generation_;
+}
+
+bool SolverContext::isResultStale(PointModelItem *target) {
+    if (this->isTargetChanged()
+            || this->model_->getModelVersion() != this->model_version_
+            || target->getGeneration() != this->target_generation_) {
+        return true;
+    }
+    if (this->drone_->model_->getGeneration() == this->drone_generation_) {
+        return false;
+    }
+    // solve started from predicted state, only stale if drone
+    // strayed from it
+    DroneState state = this->drone_->model_->predictState(
+                getMonotonicUsec());
+    return (state.pos - this->start_pos_).length()
+            > STALE_POS_TOL * GRID_SIZE;
+}
+
+void SolverContext::solve() {
+    // Do not compute new trajectories if executing
+    // sent trajectory, unless replanning it in mpc mode
+    if (this->model_->isSolvePaused(this->drone_->model_)) {
+        return;
+    }
+    // replanning an executing trajectory
+    bool is_receding = this->model_->isLiveReference();
+
+    // Do not compute trajectory if no final point selected
+    PointModelItem *target = this->getTarget();
+    if (target == nullptr) {
+        // clear current trajectory once
+        if (!this->is_cleared_) {
+            PathModelItem *traj_model = this->getTrajGraphic()->model_;
+            TrajectoryFrame *frame = traj_model->getBackFrame();
+            frame->points.resize(0);
+            frame->traj2dof = autogen::packet::traj2dof();
+            frame->is_feasible = false;
+            traj_model->publishFrame();
+            this->postGraphics();
+            this->is_cleared_ = true;
+            // force solve once a target is set again
+            this->model_version_ = INVALID_VERSION;
+        }
+        return;
+    }
+    this->is_cleared_ = false;
+
+    // read versions before inputs so a change during the
+    // solve is caught on the next pass
+    quint64 model_version = this->model_->getModelVersion();
+    quint64 drone_generation = this->drone_->model_->getGeneration();
+    quint64 target_generation = target->getGeneration();
+    bool reset_inputs = this->takeTargetChanged();
+
+    bool is_inputs_changed = reset_inputs
+            || model_version != this->model_version_
+            || drone_generation != this->drone_generation_
+            || target_generation != this->target_generation_;
+
+    // skip solve if inputs unchanged and trajectory has settled
+    if (!is_inputs_changed && (this->is_converged_
+            || this->refine_passes_ >= this->max_refine_passes_)) {
+        this->solves_skipped_++;
+        return;
+    }
+
+    // time each stage of the pass
+    QElapsedTimer total;
+    QElapsedTimer stage;
+    total.start();
+    stage.start();
+
+    QMutexLocker locker(&this->mutex_);
+    qint64 budget = this->anytime_budget_;
+    qint64 max_stale = this->period_ > 0 ? this->period_ : MAX_STALE_USEC;
+    locker.unlock();
+    // bound latency of receding horizon solves so each horizon
+    // still starts near the predicted state
+    if (is_receding && budget == 0) {
+        budget = MPC_BUDGET_USEC;
+    }
+
+    if (is_inputs_changed) {
+        this->model_version_ = model_version;
+        this->drone_generation_ = drone_generation;
+        this->target_generation_ = target_generation;
+        this->refine_passes_ = 0;
+        this->is_converged_ = false;
+        this->best_relaxation_ = std::numeric_limits<double>::max();
+
+        // Get params with constraints loaded from shared snapshot
+        std::shared_ptr<ConstraintSnapshot const> snapshot =
+                this->model_->getSnapshot();
+        // version may be newer than the one read above
+        this->model_version_ = snapshot->version;
+        this->is_free_final_time_ = snapshot->is_free_final_time;
+
+        // Start from where the drone will be when
+        // the solve is expected to finish, not at its last telemetry
+        DroneState initial_state = this->drone_->model_->predictState(
+                    getMonotonicUsec() + this->solve_estimate_);
+        QVector3D initial_pos = initial_state.pos;
+        QVector3D initial_vel = initial_state.vel;
+        QVector3D initial_acc = initial_state.accel;
+        this->start_pos_ = initial_pos;
+
+        QPointF final_pos_2D = target->getPos();
+        QVector3D final_pos = QVector3D(final_pos_2D.x(),
+                                        final_pos_2D.y(), 0);
+
+        // Parameters
+
+        // copy params since solver takes non const params
+        skyenet::params P = snapshot->P;
+        double wp[skyenet::MAX_WAYPOINTS][3];
+        std::copy(&snapshot->wp[0][0],
+                  &snapshot->wp[0][0] + (skyenet::MAX_WAYPOINTS * 3),
+                  &wp[0][0]);
+
+        // anytime mode splits the SCvx iterations over updates,
+        // refinement passes run the rest
+        this->max_refine_passes_ = MAX_REFINE_PASSES;
+        if (budget > 0) {
+            this->max_refine_passes_ = qMax<quint32>(MAX_REFINE_PASSES,
+                                                     P.max_iter);
+            P.max_iter = ANYTIME_ITERATIONS;
+        }
+
+        double r_i[3] = { 0 };
+        double v_i[3] = { 0 };
+        double a_i[3] = { 0 };
+        double r_f[3] = { 0 };
+
+        // set initial drone pos
+        QVector3D xyz_drone_pos = guiXyzToXyz(initial_pos);
+        r_i[0] = xyz_drone_pos.x();
+        r_i[1] = xyz_drone_pos.y();
+        r_i[2] = 0.0;
+
+        // set initial drone vel
+        QVector3D xyz_drone_vel = guiXyzToXyz(initial_vel);
+        v_i[0] = xyz_drone_vel.x();
+        v_i[1] = xyz_drone_vel.y();
+        v_i[2] = xyz_drone_vel.z();
+
+        // set iniital drone accel
+        QVector3D xyz_drone_acc = guiXyzToXyz(initial_acc);
+        a_i[0] = xyz_drone_acc.x();
+        a_i[1] = xyz_drone_acc.y();
+        a_i[2] = xyz_drone_acc.z();
+
+        // set final pos
+        QVector3D xyz_final_pos = guiXyzToXyz(final_pos);
+        r_f[0] = xyz_final_pos.x();
+        r_f[1] = xyz_final_pos.y();
+        r_f[2] = xyz_final_pos.z();
+
+        // check to reset inputs
+        if (reset_inputs || this->fly_ == nullptr) {
+            // continue from cached solver for this target and
+            // waypoints, or nearest one, instead of a cold start
+            WarmStartCache::MATCH match;
+            this->fly_ = this->warm_start_cache_.lookup(
+                        target, snapshot->waypoint_key, P.K, r_f, &match);
+
+            // Initialize problem
+            this->fly_->setParams(P, r_i, v_i, a_i, r_f, wp);
+            if (match == WarmStartCache::NO_MATCH) {
+                this->fly_->resetInputs(r_i, v_i, a_i, r_f, wp,
+                                        this->is_free_final_time_);
+            }
+
+            // start counting passes to converge
+            this->is_counting_passes_ = true;
+            this->is_warm_start_ = match != WarmStartCache::NO_MATCH;
+            this->passes_since_reset_ = 0;
+        } else {
+            // Initialize problem
+            this->fly_->setParams(P, r_i, v_i, a_i, r_f, wp);
+            this->warm_start_cache_.update(this->fly_, r_f);
+        }
+        this->horizon_ = P.K;
+        this->stats_.lap(SolverStats::PARAMS, &stage);
+
+        // validate inputs
+        INPUT_CODE input_code = this->validateInputs(*snapshot,
+                                                     initial_pos,
+                                                     final_pos);
+        // set valid input and update message if changed
+        if (this->model_->setIsValidInput(input_code)) {
+            this->model_->updateEllipseColors();
+            this->postMessage();
+        }
+        // Dont compute if invalid input
+        //        if (input_code != INPUT_CODE::VALID_INPUT) {
+        //            continue;
+        //        }
+        this->stats_.lap(SolverStats::VALIDATE, &stage);
+    } else {
+        // inputs unchanged, warm start refinement pass
+        // reuses params already loaded into solver
+        this->refine_passes_++;
+    }
+
+    // Run SCvx algorithm for free or fixed final time
+    skyenet::outputs const *last =
+            &this->fly_->update(this->is_free_final_time_);
+    this->solves_executed_++;
+
+    // anytime mode keeps iterating while the next iteration fits
+    // in the budget, best iterate is shown and the rest of the
+    // iterations continue on following passes
+    if (budget > 0) {
+        this->keepBest(*last);
+        qint64 iteration = stage.nsecsElapsed() / 1000;
+        while (!isFeasible(*last)
+               && (stage.nsecsElapsed() / 1000) + iteration <= budget
+               && this->refine_passes_ + 1 < this->max_refine_passes_) {
+            QElapsedTimer iteration_timer;
+            iteration_timer.start();
+            last = &this->fly_->update(this->is_free_final_time_);
+            this->refine_passes_++;
+            this->solves_executed_++;
+            this->keepBest(*last);
+            iteration = iteration_timer.nsecsElapsed() / 1000;
+        }
+    }
+    skyenet::outputs const &O = budget > 0 ? this->best_ : *last;
+    this->stats_.lap(SolverStats::SOLVE, &stage);
+
+    // write GUI trajectory points and mikipilot trajectory to send
+    // to drone in place, shown once published
+    PathModelItem *traj_model = this->getTrajGraphic()->model_;
+    TrajectoryFrame *frame = traj_model->getBackFrame();
+    readTrajectory(O, this->horizon_, &frame->points, &frame->traj2dof);
+
+    // trajectory has settled when it stops moving between passes,
+    // in anytime mode best iterate may stop moving while later
+    // iterates are still reducing relaxations
+    this->is_converged_ = this->isConverged(frame->points, O.T)
+            && (budget == 0 || isFeasible(O));
+    this->stats_.lap(SolverStats::CONVERT, &stage);
+
+    // record passes since reset once trajectory settles
+    if (this->is_counting_passes_) {
+        this->passes_since_reset_++;
+        if (this->is_converged_ ||
+                this->refine_passes_ >= this->max_refine_passes_) {
+            if (this->is_warm_start_) {
+                this->warm_starts_++;
+                this->warm_start_passes_ += this->passes_since_reset_;
+            } else {
+                this->cold_starts_++;
+                this->cold_start_passes_ += this->passes_since_reset_;
+            }
+            this->stats_.recordIterations(this->passes_since_reset_);
+            this->is_counting_passes_ = false;
+        }
+    }
+
+    // Do not display new trajectories if executing
+    // sent trajectory. Needed because sometimes compute
+    // overlaps with setting live reference mode
+    if (this->model_->isSolvePaused(this->drone_->model_)) {
+        this->stats_.record(SolverStats::TOTAL,
+                            total.nsecsElapsed() / 1000);
+        return;
+    }
+
+    // drop result if inputs changed during solve, the next pass
+    // solves for them. Shown anyway if none was shown for a
+    // period so a constantly moving drone still gets a trajectory.
+    // Receding horizons start from the predicted state so newer
+    // telemetry does not make them stale
+    qint64 now = this->clock_.nsecsElapsed() / 1000;
+    if (!is_receding && this->isResultStale(target)
+            && now - this->last_publish_ < max_stale) {
+        this->results_dropped_++;
+        this->stats_.record(SolverStats::TOTAL,
+                            total.nsecsElapsed() / 1000);
+        return;
+    }
+
+    // hand trajectory to graphical display and staging, with
+    // feasibility of this solve for splicing
+    bool is_feasible = isFeasible(O);
+    frame->is_feasible = is_feasible;
+    traj_model->publishFrame();
+
+    if (!is_feasible) {
+        // infeasible traj, set feasibility code and traj color to red
+        this->model_->setIsValidTraj(FEASIBILITY_CODE::INFEASIBLE);
+    } else {
+        // feasible traj, set feasibility code and traj color to nominal
+        this->model_->setIsValidTraj(FEASIBILITY_CODE::FEASIBLE);
+    }
+    if (this->is_free_final_time_) {
+        this->postFinalTime(O.T);
+    }
+    this->postMessage();
+
+    // iterate still improving, not final until feasible or
+    // out of iterations
+    bool is_converging = budget > 0 && !is_feasible
+            && !this->is_converged_
+            && this->refine_passes_ < this->max_refine_passes_;
+    this->setFeasibilityColor(is_feasible, is_converging);
+    this->stats_.lap(SolverStats::EMIT, &stage);
+
+    qint64 elapsed = total.nsecsElapsed() / 1000;
+    this->stats_.record(SolverStats::TOTAL, elapsed);
+    this->solve_estimate_ += qRound64(SOLVE_ESTIMATE_GAIN *
+                                      (elapsed - this->solve_estimate_));
+    this->finishPeriod(this->clock_.nsecsElapsed() / 1000);
+}
+
+void SolverContext::postGraphics() {
+    QMutexLocker locker(&this->mutex_);
+    this->is_graphics_pending_ = true;
+}
+
+void SolverContext::postMessage() {
+    QMutexLocker locker(&this->mutex_);
+    this->is_message_pending_ = true;
+}
+
+void SolverContext::postFinalTime(double final_time) {
+    QMutexLocker locker(&this->mutex_);
+    this->is_final_time_pending_ = true;
+    this->pending_final_time_ = final_time;
+}
+
+void SolverContext::flushNotifications() {
+    // take pending flags, emit without lock since slots
+    // may call back into context
+    QMutexLocker locker(&this->mutex_);
+    bool is_graphics_pending = this->is_graphics_pending_;
+    bool is_message_pending = this->is_message_pending_;
+    bool is_final_time_pending = this->is_final_time_pending_;
+    double final_time = this->pending_final_time_;
+    this->is_graphics_pending_ = false;
+    this->is_message_pending_ = false;
+    this->is_final_time_pending_ = false;
+    PathGraphicsItem *traj = this->traj_graphic_;
+    DroneGraphicsItem *drone = this->drone_;
+    locker.unlock();
+
+    if (is_final_time_pending) {
+        emit finalTime(drone->model_, final_time);
+    }
+    if (is_message_pending) {
+        emit updateMessage(drone->model_);
+    }
+    if (is_graphics_pending) {
+        emit updateGraphics(traj, drone);
+    }
+}
+
+bool SolverContext::isConverged(QVector<QPointF> const &trajectory,
+                                qreal final_time) {
+    bool is_converged =
+            trajectory.size() == this->last_trajectory_.size()
+            && qAbs(final_time - this->last_final_time_)
+               < CONVERGED_TIME_TOL;
+
+    // compare against last pass, tolerance in pixels
+    for (int i = 0; is_converged && i < trajectory.size(); i++) {
+        QPointF diff = trajectory.at(i) - this->last_trajectory_.at(i);
+        if (diff.manhattanLength() > CONVERGED_POS_TOL) {
+            is_converged = false;
+        }
+    }
+
+    // copy by element so last trajectory never shares a frame
+    // buffer, sharing would make the solver reallocate it
+    this->last_trajectory_.resize(trajectory.size());
+    std::copy(trajectory.constBegin(), trajectory.constEnd(),
+              this->last_trajectory_.begin());
+    this->last_final_time_ = final_time;
+    return is_converged;
+}
+
+void SolverContext::keepBest(skyenet::outputs const &O) {
+    // later iterates win ties, they are further refined
+    double relaxation = getRelaxation(O);
+    if (relaxation <= this->best_relaxation_) {
+        this->best_ = O;
+        this->best_relaxation_ = relaxation;
+    }
+}
+
+void SolverContext::setFeasibilityColor(bool is_feasible,
+                                        bool is_converging) {
+    // get graphics items
+    DroneGraphicsItem *drone = this->getDroneGraphic();
+    PathGraphicsItem *traj = this->getTrajGraphic();
+
+    // set feasiblility color
+    if (is_feasible) {
+        traj->setColor(YELLOW);
+        drone->setIsFeasible(true);
+    } else {
+        traj->setColor(RED);
+        drone->setIsFeasible(false);
+    }
+    traj->setConverging(is_converging);
+    this->postGraphics();
+}
+
+INPUT_CODE SolverContext::validateInputs(
+    ConstraintSnapshot const &snapshot,
+    QVector3D const &initial_pos,
+    QVector3D const &final_pos) {
+    skyenet::params const &P = snapshot.P;
+
+    // convert to meters to match solver obstacles
+    QVector3D xyz_initial_pos = guiXyzToXyz(initial_pos);
+    QVector3D xyz_final_pos = guiXyzToXyz(final_pos);
+
+    for (quint32 i = 0; i < P.obs.n; i++) {
+        // check if contains drone
+        if (this->isInsideEllipse(P, i, xyz_initial_pos.x(),
+                                  xyz_initial_pos.y())) {
+            return INPUT_CODE::DRONE_OVERLAP;
+        }
+
+        // check if contains final point
+        if (this->isInsideEllipse(P, i, xyz_final_pos.x(),
+                                  xyz_final_pos.y())) {
+            return INPUT_CODE::FINAL_POS_OVERLAP;
+        }
+    }
+
+    // overlap found by obstacle index when snapshot was built
+    if (snapshot.is_obs_overlap) {
+        return INPUT_CODE::OBS_OVERLAP;
+    }
+    return INPUT_CODE::VALID_INPUT;
+}
+
+bool SolverContext::isInsideEllipse(skyenet::params const &P,
+                                    quint32 index, qreal x, qreal y) {
+    // point is inside when |M(p - c)| < 1, same
+    // shape matrix the solver uses
+    qreal dx = x - P.obs.c_x[index];
+    qreal dy = y - P.obs.c_y[index];
+    qreal u = (P.obs.M0[0][index] * dx) + (P.obs.M0[1][index] * dy);
+    qreal v = (P.obs.M1[0][index] * dx) + (P.obs.M1[1][index] * dy);
+    return ((u * u) + (v * v)) < 1.0;
+}
+
+}  // namespace optgui
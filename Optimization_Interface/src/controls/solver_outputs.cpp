@@ -0,0 +1,123 @@
+// TITLE:   Optimization_Interface/src/controls/solver_outputs.cpp
+// AUTHORS: Daniel Sullivan
+// LAB:     Autonomous Controls Lab (ACL)
+// LICENSE: Copyright 2020, All Rights Reserved
+
+#include "include/controls/solver_outputs.h"
+
+#include <QVector3D>
+#include <QtMath>
+
+#include <cmath>
+
+#include "include/globals.h"
+
+namespace optgui {
+    // convergence tolerances in meters and seconds, one pixel
+    // and one millisecond
+    static double const CONVERGED_POS_TOL = 0.01;
+    static double const CONVERGED_TIME_TOL = 0.001;
+    // max sum of squared relaxations of feasible trajectory
+    static double const FEASIBLE_RELAXATION = 0.25;
+
+    void readTrajectory(skyenet::outputs const &O, quint32 size,
+                        QVector<QPointF> *trajectory,
+                        autogen::packet::traj2dof *traj2dof) {
+        traj2dof->K = size;
+        // overwrite in place, keeps capacity of reused vectors
+        trajectory->resize(size);
+
+        for (quint32 i = 0; i < size; i++) {
+            // Add points to GUI trajectory
+            QVector3D gui_coords = xyzToGuiXyz(O.r[0][i],
+                                               O.r[1][i],
+                                               O.r[2][i]);
+            (*trajectory)[i] = QPointF(gui_coords.x(), gui_coords.y());
+
+            // Add data to mikipilot trajectory
+            // traj2dof->clock_angle(k) = 90.0/180.0*3.141592*P.dt*k;
+            traj2dof->time(i) = O.t[i];
+
+            // XYZ to NED conversion
+            traj2dof->pos_ned(0, i) =  O.r[1][i];
+            traj2dof->pos_ned(1, i) =  O.r[0][i];
+            // traj2dof->pos_ned(2, i) = -O.r[2][i];
+
+            traj2dof->vel_ned(0, i) =  O.v[1][i];
+            traj2dof->vel_ned(1, i) =  O.v[0][i];
+            // traj2dof->vel_ned(2, i) = -O.v[2][i];
+
+            traj2dof->accl_ned(0, i) =  O.a[1][i];
+            traj2dof->accl_ned(1, i) =  O.a[0][i];
+            // traj2dof->accl_ned(2, i) = -O.a[2][i];
+        }
+    }
+
+    double getRelaxation(skyenet::outputs const &O) {
+        // OUTPUT VIOLATIONS: initial and final pos violation
+        return pow(O.rf_relax[0], 2)  // final pos
+             + pow(O.rf_relax[1], 2)
+             + pow(O.rf_relax[2], 2)
+
+             + pow(O.ri_relax[0], 2)  // initial pos
+             + pow(O.ri_relax[1], 2)
+             + pow(O.ri_relax[2], 2)
+
+             + pow(O.dtau, 2);  // change in time
+    }
+
+    bool isFeasible(skyenet::outputs const &O) {
+        return getRelaxation(O) <= FEASIBLE_RELAXATION;
+    }
+
+    double getPeakAccel(skyenet::outputs const &O, quint32 size) {
+        double peak_accel = 0;
+        for (quint32 i = 0; i < size; i++) {
+            double accel = qSqrt(qPow(O.a[0][i], 2) +
+                                 qPow(O.a[1][i], 2) +
+                                 qPow(O.a[2][i], 2));
+            peak_accel = qMax(peak_accel, accel);
+        }
+        return peak_accel;
+    }
+
+    skyenet::outputs const &solveUntilConverged(TrajectorySolver *fly,
+                                                quint32 size,
+                                                bool is_free_final_time,
+                                                quint32 max_passes,
+                                                quint32 *passes) {
+        skyenet::outputs const *O = &fly->update(is_free_final_time);
+        *passes = 1;
+
+        // positions of last pass in meters
+        QVector<double> last_r(2 * size);
+        double last_final_time = O->T;
+        for (quint32 i = 0; i < size; i++) {
+            last_r[2 * i] = O->r[0][i];
+            last_r[(2 * i) + 1] = O->r[1][i];
+        }
+
+        while (*passes < max_passes) {
+            O = &fly->update(is_free_final_time);
+            (*passes)++;
+
+            // compare against last pass and save it
+            bool is_converged =
+                    qAbs(O->T - last_final_time) < CONVERGED_TIME_TOL;
+            last_final_time = O->T;
+            for (quint32 i = 0; i < size; i++) {
+                for (quint32 j = 0; j < 2; j++) {
+                    if (qAbs(O->r[j][i] - last_r.at((2 * i) + j))
+                            > CONVERGED_POS_TOL) {
+                        is_converged = false;
+                    }
+                    last_r[(2 * i) + j] = O->r[j][i];
+                }
+            }
+            if (is_converged) {
+                break;
+            }
+        }
+        return *O;
+    }
+}  // namespace optgui
@@ -0,0 +1,147 @@
+// TITLE:   Optimization_Interface/src/controls/solver_scheduler.cpp
+// AUTHORS: Daniel Sullivan
+// LAB:     Autonomous Controls Lab (ACL)
+// LICENSE: Copyright 2020, All Rights Reserved
+
+#include "include/controls/solver_scheduler.h"
+
+#include <QThread>
+
+#include "include/controls/compute_thread.h"
+
+namespace optgui {
+
+SolverScheduler::SolverScheduler(ConstraintModel *model) : mutex_() {
+    this->model_ = model;
+    this->cursor_ = 0;
+    this->is_priority_turn_ = true;
+
+    // leave one core for the GUI thread
+    int num_threads = qMax(1, QThread::idealThreadCount() - 1);
+    for (int i = 0; i < num_threads; i++) {
+        ComputeThread *thread = new ComputeThread(this->model_, this);
+        this->threads_.append(thread);
+        thread->start();
+    }
+}
+
+SolverScheduler::~SolverScheduler() {
+    // flag all threads to stop, then wait for current solves
+    for (ComputeThread *thread : this->threads_) {
+        thread->stopCompute();
+    }
+    for (ComputeThread *thread : this->threads_) {
+        thread->wait();
+        delete thread;
+    }
+    this->threads_.clear();
+
+    for (SolverContext *context : this->contexts_) {
+        delete context;
+    }
+    this->contexts_.clear();
+}
+
+void SolverScheduler::addContext(SolverContext *context) {
+    QMutexLocker locker(&this->mutex_);
+    this->contexts_.append(context);
+    locker.unlock();
+    // wake threads to solve for new drone
+    this->model_->notifyChange();
+}
+
+void SolverScheduler::removeContext(SolverContext *context) {
+    QMutexLocker locker(&this->mutex_);
+    this->contexts_.removeOne(context);
+    // wait for thread solving it to finish current pass
+    while (this->borrowed_.contains(context)) {
+        this->released_.wait(&this->mutex_);
+    }
+    locker.unlock();
+    delete context;
+}
+
+void SolverScheduler::removeTarget(PointModelItem *target) {
+    QMutexLocker locker(&this->mutex_);
+    // contexts are only added and removed by caller's thread.
+    // Context is not acquired again while lock is held, and
+    // acquired later it no longer has target
+    for (int i = 0; i < this->contexts_.size(); i++) {
+        SolverContext *context = this->contexts_.at(i);
+        while (this->borrowed_.contains(context)) {
+            this->released_.wait(&this->mutex_);
+        }
+        context->removeTarget(target);
+    }
+    locker.unlock();
+    // wake threads to clear removed target trajectories
+    this->model_->notifyChange();
+}
+
+SolverContext *SolverScheduler::acquire(qint64 *wait_usec) {
+    QMutexLocker locker(&this->mutex_);
+    *wait_usec = -1;
+
+    int size = this->contexts_.size();
+    // on priority turn first pass is only priority drones,
+    // otherwise all drones round robin. Alternating turns keeps
+    // a busy priority drone from starving the rest
+    for (int pass = 0; pass < 2; pass++) {
+        bool priority_only = (pass == 0) && this->is_priority_turn_;
+        for (int i = 0; i < size; i++) {
+            int index = (this->cursor_ + i) % size;
+            SolverContext *context = this->contexts_.at(index);
+            if (this->borrowed_.contains(context)) {
+                continue;
+            }
+            bool is_priority = this->isPriority(context);
+            if (priority_only && !is_priority) {
+                continue;
+            }
+            if (context->hasWork()) {
+                // not due yet, sleep until soonest due context
+                qint64 delay = context->getStartDelay();
+                if (delay > 0) {
+                    if (*wait_usec < 0 || delay < *wait_usec) {
+                        *wait_usec = delay;
+                    }
+                    continue;
+                }
+                this->borrowed_.append(context);
+                this->is_priority_turn_ = !is_priority;
+                // start after this one next time
+                if (!priority_only) {
+                    this->cursor_ = (index + 1) % size;
+                }
+                return context;
+            }
+        }
+    }
+    return nullptr;
+}
+
+void SolverScheduler::release(SolverContext *context) {
+    QMutexLocker locker(&this->mutex_);
+    this->borrowed_.removeOne(context);
+    this->released_.wakeAll();
+}
+
+int SolverScheduler::getNumThreads() {
+    return this->threads_.size();
+}
+
+quint64 SolverScheduler::getIdleWakeups() {
+    quint64 wakeups = 0;
+    for (ComputeThread *thread : this->threads_) {
+        wakeups += thread->getIdleWakeups();
+    }
+    return wakeups;
+}
+
+bool SolverScheduler::isPriority(SolverContext *context) {
+    DroneModelItem *drone = context->getDroneGraphic()->model_;
+    return this->model_->isCurrDrone(drone) ||
+            this->model_->getStagedDrone() == drone;
+}
+
+}  // namespace optgui
@@ -0,0 +1,163 @@
+// TITLE:   Optimization_Interface/src/controls/solver_stats.cpp
+// AUTHORS: Daniel Sullivan
+// LAB:     Autonomous Controls Lab (ACL)
+// LICENSE: Copyright 2020, All Rights Reserved
+
+#include "include/controls/solver_stats.h"
+
+#include <QtAlgorithms>
+#include <QtMath>
+
+namespace optgui {
+
+Histogram::Histogram() {
+    for (int i = 0; i < NUM_BUCKETS; i++) {
+        this->counts_[i] = 0;
+    }
+    this->count_ = 0;
+    this->sum_ = 0;
+    this->max_ = 0;
+}
+
+void Histogram::record(quint64 value) {
+    this->counts_[getBucket(value)].fetchAndAddRelaxed(1);
+    this->sum_.fetchAndAddRelaxed(value);
+    this->count_.fetchAndAddRelease(1);
+
+    // raise max unless another thread raised it higher
+    quint64 max = this->max_.load();
+    while (value > max && !this->max_.testAndSetOrdered(max, value, max)) {
+    }
+}
+
+quint64 Histogram::getCount() const {
+    return this->count_.loadAcquire();
+}
+
+quint64 Histogram::getMax() const {
+    return this->max_.load();
+}
+
+double Histogram::getMean() const {
+    quint64 count = this->getCount();
+    if (count == 0) {
+        return 0;
+    }
+    return static_cast<double>(this->sum_.load()) / count;
+}
+
+quint64 Histogram::getPercentile(double q) const {
+    // sum buckets, total may lag bucket counts during a record
+    quint64 total = 0;
+    for (int i = 0; i < NUM_BUCKETS; i++) {
+        total += this->counts_[i].load();
+    }
+    if (total == 0) {
+        return 0;
+    }
+
+    quint64 rank = qMax<quint64>(1, qCeil(q * total));
+    quint64 seen = 0;
+    for (int i = 0; i < NUM_BUCKETS; i++) {
+        seen += this->counts_[i].load();
+        if (seen >= rank) {
+            return qMin(getBucketHigh(i) - 1, this->getMax());
+        }
+    }
+    return this->getMax();
+}
+
+void Histogram::writeBuckets(QTextStream *stream,
+                             QString const &prefix) const {
+    for (int i = 0; i < NUM_BUCKETS; i++) {
+        quint64 count = this->counts_[i].load();
+        if (count > 0) {
+            *stream << prefix << "," << getBucketLow(i) << ","
+                    << getBucketHigh(i) << "," << count << endl;
+        }
+    }
+}
+
+int Histogram::getBucket(quint64 value) {
+    // exact below first octave
+    if (value < SUB_BUCKETS) {
+        return value;
+    }
+    // octave from highest bit, sub bucket from next 3 bits
+    int msb = 63 - qCountLeadingZeroBits(value);
+    int octave = msb - 2;
+    int sub = (value >> (msb - 3)) & (SUB_BUCKETS - 1);
+    return qMin((octave * SUB_BUCKETS) + sub, NUM_BUCKETS - 1);
+}
+
+quint64 Histogram::getBucketLow(int bucket) {
+    if (bucket < SUB_BUCKETS) {
+        return bucket;
+    }
+    int octave = bucket / SUB_BUCKETS;
+    int sub = bucket % SUB_BUCKETS;
+    return static_cast<quint64>(SUB_BUCKETS + sub) << (octave - 1);
+}
+
+quint64 Histogram::getBucketHigh(int bucket) {
+    if (bucket < SUB_BUCKETS) {
+        return bucket + 1;
+    }
+    int octave = bucket / SUB_BUCKETS;
+    return getBucketLow(bucket) + (1ULL << (octave - 1));
+}
+
+SolverStats::SolverStats() {
+    this->rate_timer_.start();
+    this->rate_solves_ = 0;
+}
+
+void SolverStats::lap(STAGE stage, QElapsedTimer *timer) {
+    this->record(stage, timer->nsecsElapsed() / 1000);
+    timer->restart();
+}
+
+void SolverStats::record(STAGE stage, quint64 usec) {
+    this->latency_[stage].record(usec);
+}
+
+void SolverStats::recordIterations(quint32 passes) {
+    this->iterations_.record(passes);
+}
+
+Histogram const &SolverStats::getLatency(STAGE stage) const {
+    return this->latency_[stage];
+}
+
+Histogram const &SolverStats::getIterations() const {
+    return this->iterations_;
+}
+
+quint64 SolverStats::getSolves() const {
+    return this->latency_[TOTAL].getCount();
+}
+
+double SolverStats::takeSolveRate() {
+    quint64 solves = this->getSolves();
+    qint64 msec = this->rate_timer_.restart();
+    double rate = 0;
+    if (msec > 0) {
+        rate = 1000.0 * (solves - this->rate_solves_) / msec;
+    }
+    this->rate_solves_ = solves;
+    return rate;
+}
+
+QString SolverStats::getStageName(STAGE stage) {
+    switch (stage) {
+        case PARAMS: return "params";
+        case VALIDATE: return "validate";
+        case SOLVE: return "solve";
+        case CONVERT: return "convert";
+        case EMIT: return "emit";
+        case TOTAL: return "total";
+        default: return "";
+    }
+}
+
+}  // namespace optgui
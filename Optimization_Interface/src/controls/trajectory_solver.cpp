@@ -0,0 +1,29 @@
+// TITLE:   Optimization_Interface/src/controls/trajectory_solver.cpp
+// AUTHORS: Daniel Sullivan
+// LAB:     Autonomous Controls Lab (ACL)
+// LICENSE: Copyright 2020, All Rights Reserved
+
+#include "include/controls/trajectory_solver.h"
+
+#include <QtGlobal>
+
+#include "include/controls/reference_solver.h"
+#ifndef OPTGUI_REFERENCE_SOLVER
+#include "include/controls/skyefly_solver.h"
+#endif
+
+namespace optgui {
+
+TrajectorySolver *TrajectorySolver::create() {
+#ifdef OPTGUI_REFERENCE_SOLVER
+    // skyenet not linked
+    return new ReferenceSolver();
+#else
+    if (qgetenv("OPTGUI_SOLVER") == "reference") {
+        return new ReferenceSolver();
+    }
+    return new SkyeFlySolver();
+#endif
+}
+
+}  // namespace optgui
@@ -0,0 +1,126 @@
+// TITLE:   Optimization_Interface/src/controls/warm_start_cache.cpp
+// AUTHORS: Daniel Sullivan
+// LAB:     Autonomous Controls Lab (ACL)
+// LICENSE: Copyright 2020, All Rights Reserved
+
+#include "include/controls/warm_start_cache.h"
+
+#include <QtMath>
+
+#include <limits>
+
+namespace optgui {
+
+WarmStartCache::WarmStartCache() {
+    this->clock_ = 0;
+}
+
+WarmStartCache::~WarmStartCache() {
+    for (Entry &entry : this->entries_) {
+        delete entry.fly;
+    }
+    this->entries_.clear();
+}
+
+TrajectorySolver *WarmStartCache::lookup(PointModelItem *target,
+                                         quint64 waypoint_key,
+                                         quint32 horizon,
+                                         double const r_f[3],
+                                         MATCH *match) {
+    this->clock_++;
+
+    int exact = -1;
+    // same target, waypoints changed
+    int same_target = -1;
+    double same_target_dist = std::numeric_limits<double>::max();
+    // same waypoints, nearby target
+    int nearest = -1;
+    double nearest_dist = NEAREST_RADIUS;
+    int oldest = -1;
+
+    for (int i = 0; i < this->entries_.size(); i++) {
+        Entry const &entry = this->entries_.at(i);
+        if (oldest < 0 ||
+                entry.last_used < this->entries_.at(oldest).last_used) {
+            oldest = i;
+        }
+        // trajectory can only be reused with same number of nodes
+        if (entry.horizon != horizon) {
+            continue;
+        }
+
+        double dist = distance(entry.r_f, r_f);
+        if (entry.target == target) {
+            if (entry.waypoint_key == waypoint_key) {
+                exact = i;
+                break;
+            }
+            if (dist < same_target_dist) {
+                same_target = i;
+                same_target_dist = dist;
+            }
+        } else if (entry.waypoint_key == waypoint_key &&
+                   dist < nearest_dist) {
+            nearest = i;
+            nearest_dist = dist;
+        }
+    }
+
+    int index;
+    if (exact >= 0) {
+        index = exact;
+        *match = EXACT_MATCH;
+    } else if (same_target >= 0 || nearest >= 0) {
+        index = same_target >= 0 ? same_target : nearest;
+        *match = NEAREST_MATCH;
+    } else if (this->entries_.size() < CAPACITY) {
+        Entry entry;
+        entry.fly = TrajectorySolver::create();
+        this->entries_.append(entry);
+        index = this->entries_.size() - 1;
+        *match = NO_MATCH;
+    } else {
+        // evict least recently used, solver is reset by caller
+        index = oldest;
+        *match = NO_MATCH;
+    }
+
+    // re-key entry, reused solvers are moved not copied
+    Entry &entry = this->entries_[index];
+    entry.target = target;
+    entry.waypoint_key = waypoint_key;
+    entry.horizon = horizon;
+    entry.r_f[0] = r_f[0];
+    entry.r_f[1] = r_f[1];
+    entry.r_f[2] = r_f[2];
+    entry.last_used = this->clock_;
+    return entry.fly;
+}
+
+void WarmStartCache::update(TrajectorySolver *fly, double const r_f[3]) {
+    for (Entry &entry : this->entries_) {
+        if (entry.fly == fly) {
+            entry.r_f[0] = r_f[0];
+            entry.r_f[1] = r_f[1];
+            entry.r_f[2] = r_f[2];
+            return;
+        }
+    }
+}
+
+void WarmStartCache::removeTarget(PointModelItem *target) {
+    for (Entry &entry : this->entries_) {
+        if (entry.target == target) {
+            entry.target = nullptr;
+            entry.last_used = 0;
+        }
+    }
+}
+
+double WarmStartCache::distance(double const a[3], double const b[3]) {
+    return qSqrt(qPow(a[0] - b[0], 2) +
+                 qPow(a[1] - b[1], 2) +
+                 qPow(a[2] - b[2], 2));
+}
+
+}  // namespace optgui
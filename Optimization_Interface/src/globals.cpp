@@ -5,6 +5,8 @@
 
 #include "include/globals.h"
 
+#include <chrono>
+
 namespace optgui {
     qreal const GRID_SIZE = 100.0;
     qreal const INIT_CLEARANCE = 0.5;
@@ -62,4 +64,10 @@ namespace optgui {
                          -1.0 * y * GRID_SIZE,
                          z * GRID_SIZE);
     }
+
+    qint64 getMonotonicUsec() {
+        return std::chrono::duration_cast<std::chrono::microseconds>(
+                    std::chrono::steady_clock::now().time_since_epoch())
+                .count();
+    }
 }  // namespace optgui
@@ -0,0 +1,122 @@
+// TITLE:   Optimization_Interface/src/graphics/candidate_graphics_item.cpp
+// AUTHORS: Daniel Sullivan
+// LAB:     Autonomous Controls Lab (ACL)
+// LICENSE: Copyright 2020, All Rights Reserved
+
+#include "include/graphics/candidate_graphics_item.h"
+
+#include <QGraphicsScene>
+#include <QGraphicsView>
+#include <QPainterPathStroker>
+
+namespace optgui {
+
+CandidateGraphicsItem::CandidateGraphicsItem(QVector<QPointF> points,
+                                             quint32 rank,
+                                             bool is_feasible,
+                                             QGraphicsItem *parent,
+                                             quint32 size)
+    : QGraphicsItem(parent) {
+    this->points_ = points;
+    this->rank_ = rank;
+    this->width_ = size;
+
+    // dashed to tell apart from current traj
+    this->pen_ = QPen(is_feasible ? CYAN : RED);
+    this->pen_.setStyle(Qt::DashLine);
+    this->pen_.setWidth(this->width_);
+
+    // Set flags
+    this->setFlags(QGraphicsItem::ItemIsSelectable);
+
+    // Set area
+    this->updateGeometry();
+}
+
+QRectF CandidateGraphicsItem::boundingRect() const {
+    // cached area, see updateGeometry
+    return this->bounds_;
+}
+
+void CandidateGraphicsItem::updateGeometry() {
+    QRectF bounds = this->getBounds();
+    if (bounds != this->bounds_) {
+        // notify scene index before area changes
+        this->prepareGeometryChange();
+        this->bounds_ = bounds;
+    }
+}
+
+QRectF CandidateGraphicsItem::getBounds() const {
+    // return rough area of traj line
+    return this->shape().boundingRect();
+}
+
+void CandidateGraphicsItem::paint(QPainter *painter,
+                                  const QStyleOptionGraphicsItem *option,
+                                  QWidget *widget) {
+    // suppress unused options errors
+    Q_UNUSED(option);
+    Q_UNUSED(widget);
+
+    // thicker line if selected
+    qreal scaling_factor = this->getScalingFactor();
+    if (this->isSelected()) {
+        this->pen_.setWidthF(2 * this->width_ / scaling_factor);
+    } else {
+        this->pen_.setWidthF(this->width_ / scaling_factor);
+    }
+    painter->setPen(this->pen_);
+    painter->drawPolyline(this->points_.constData(), this->points_.size());
+
+    // label end of traj with rank
+    if (!this->points_.isEmpty()) {
+        QFont font = painter->font();
+        font.setPointSizeF(10 / scaling_factor);
+        painter->setFont(font);
+        painter->drawText(this->points_.last() +
+                          QPointF(8, -8) / scaling_factor,
+                          QString::number(this->rank_ + 1));
+    }
+}
+
+QPainterPath CandidateGraphicsItem::shape() const {
+    // stroke line so clicks near it select it
+    QPainterPath path;
+    if (this->points_.isEmpty()) {
+        return path;
+    }
+    path.addPolygon(QPolygonF(this->points_));
+    QPainterPathStroker stroker;
+    stroker.setWidth(12 / this->getScalingFactor());
+    return stroker.createStroke(path);
+}
+
+int CandidateGraphicsItem::type() const {
+    // return unique graphics type
+    return CANDIDATE_GRAPHIC;
+}
+
+quint32 CandidateGraphicsItem::getRank() {
+    return this->rank_;
+}
+
+QVariant CandidateGraphicsItem::itemChange(GraphicsItemChange change,
+                                           const QVariant &value) {
+    if (change == ItemSceneHasChanged) {
+        // area scales with zoom of new scene
+        this->updateGeometry();
+    }
+    return QGraphicsItem::itemChange(change, value);
+}
+
+qreal CandidateGraphicsItem::getScalingFactor() const {
+    // get scaling zoom factor from view
+    qreal scaling_factor = 1;
+    if (this->scene() && !this->scene()->views().isEmpty()) {
+        scaling_factor = this->scene()->views().first()->matrix().m11();
+    }
+    return scaling_factor;
+}
+
+}  // namespace optgui
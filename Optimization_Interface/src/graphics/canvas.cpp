@@ -8,6 +8,7 @@
 #include <QPainter>
 #include <QGraphicsView>
 #include <QGraphicsItem>
+#include <QtMath>
 
 #include <cmath>
 #include <limits>
@@ -17,7 +18,7 @@
 namespace optgui {
 
 Canvas::Canvas(QObject *parent, QString background_file)
-    : QGraphicsScene(parent) {
+    : QGraphicsScene(parent), grid_tiles_(MAX_GRID_TILES) {
 
     // set background brush
     this->setBackgroundBrush(BLACK);
@@ -34,14 +35,16 @@ Canvas::Canvas(QObject *parent, QString background_file)
     // Set text font
     this->font_ = QFont("SansSerif");
 
-    // Set flags
-    this->setItemIndexMethod(QGraphicsScene::ItemIndexMethod::NoIndex);
+    // Set flags, items keep cached areas valid so they can be indexed
+    this->setItemIndexMethod(QGraphicsScene::ItemIndexMethod::BspTreeIndex);
 
     // Connect slots
     connect(this, SIGNAL(selectionChanged()), this,
             SLOT(bringSelectedToFront()));
 
     this->front_depth_ = 0;
+    this->path_staged_graphic_ = nullptr;
+    this->grid_tiles_zoom_ = 0;
     this->setBackgroundImage(background_file);
 }
 
@@ -77,7 +80,19 @@ void Canvas::setBackgroundImage(QString filename) {
         this->background_topright_y_ = list[5].toDouble();
     }
 
-    this->background_image_ = QImage(":/assets/" + filename + ".png");
+    // position of background image in scene
+    double width  = this->background_topright_y_
+            - this->background_bottomleft_y_;
+    double height = this->background_topright_x_
+            - this->background_bottomleft_x_;
+    QRectF bbox(this->background_bottomleft_y_*GRID_SIZE,
+                -this->background_topright_x_*GRID_SIZE,
+                width*GRID_SIZE,
+                height*GRID_SIZE);
+
+    // split image into tiles once, drawing only blits visible ones
+    this->background_.setImage(
+                QImage(":/assets/" + filename + ".png"), bbox);
 }
 
 void Canvas::bringSelectedToFront() {
@@ -102,12 +117,55 @@ void Canvas::updateGraphicsItems(PathGraphicsItem *traj,
     // verify graphics exist
     if (this->path_graphics_.contains(traj) &&
         this->drone_graphics_.contains(drone)) {
-        // schedule re-draw
+        // take new traj area then schedule re-draw
+        traj->updateGeometry();
         traj->update(traj->boundingRect());
         drone->update(drone->boundingRect());
     }
 }
 
+void Canvas::updateGeometry() {
+    for (PathGraphicsItem *graphic : this->path_graphics_) {
+        graphic->updateGeometry();
+    }
+    if (this->path_staged_graphic_) {
+        this->path_staged_graphic_->updateGeometry();
+    }
+    for (CandidateGraphicsItem *graphic : this->candidate_graphics_) {
+        graphic->updateGeometry();
+    }
+    for (DroneGraphicsItem *graphic : this->drone_graphics_) {
+        graphic->updateGeometry();
+    }
+    for (EllipseGraphicsItem *graphic : this->ellipse_graphics_) {
+        graphic->updateGeometry();
+    }
+    for (CylinderGraphicsItem *graphic : this->cylinder_graphics_) {
+        graphic->updateGeometry();
+    }
+    for (PolygonGraphicsItem *graphic : this->polygon_graphics_) {
+        graphic->updateGeometry();
+    }
+    for (PlaneGraphicsItem *graphic : this->plane_graphics_) {
+        graphic->updateGeometry();
+    }
+    for (PointGraphicsItem *graphic : this->final_points_) {
+        graphic->updateGeometry();
+    }
+    for (WaypointGraphicsItem *graphic : this->waypoint_graphics_) {
+        graphic->updateGeometry();
+    }
+}
+
+void Canvas::setIndexed(bool is_indexed) {
+    if (is_indexed) {
+        this->setItemIndexMethod(
+                    QGraphicsScene::ItemIndexMethod::BspTreeIndex);
+    } else {
+        this->setItemIndexMethod(QGraphicsScene::ItemIndexMethod::NoIndex);
+    }
+}
+
 void Canvas::bringToFront(QGraphicsItem *item) {
     if (item->type() == ELLIPSE_GRAPHIC ||
             item->type() == CYLINDER_GRAPHIC ||
@@ -139,19 +197,27 @@ void Canvas::drawForeground(QPainter *painter, const QRectF &rect) {
     painter->setPen(this->foreground_pen_);
     painter->setFont(this->font_);
 
+    // anchor scale to view corner, rect may only be a changed area
+    QRectF corner = rect;
+    if (!this->views().isEmpty()) {
+        QGraphicsView *view = this->views().first();
+        corner = view->mapToScene(view->viewport()->rect()).boundingRect();
+    }
+
     // Draw scale
-    painter->drawLine(rect.left() + offset, rect.bottom() - offset,
-                      rect.left() + (offset + segment_size),
-                      rect.bottom() - offset);
+    painter->drawLine(corner.left() + offset, corner.bottom() - offset,
+                      corner.left() + (offset + segment_size),
+                      corner.bottom() - offset);
     // Draw notches on scale
     for (qint32 i = 0; i <= segment_size; i += segment_size) {
-        painter->drawLine(rect.left() + offset + i, rect.bottom() - offset,
-                          rect.left() + offset + i,
-                          rect.bottom() - notch_offset);
+        painter->drawLine(corner.left() + offset + i,
+                          corner.bottom() - offset,
+                          corner.left() + offset + i,
+                          corner.bottom() - notch_offset);
     }
 
     // Draw label
-    painter->drawText(rect.left() + offset, rect.bottom() - text_offset,
+    painter->drawText(corner.left() + offset, corner.bottom() - text_offset,
                       QString::number(qreal(segment_size) / GRID_SIZE) + "m");
 }
 
@@ -169,6 +235,69 @@ void Canvas::drawBackground(QPainter *painter, const QRectF &rect) {
     // Fill background
     QGraphicsScene::drawBackground(painter, rect);
 
+    // draw background image at level of detail for zoom
+    this->background_.draw(painter, rect, this->getScalingFactor());
+
+    QTransform transform = painter->transform();
+    if (transform.type() > QTransform::TxScale ||
+            transform.m11() != transform.m22()) {
+        // tiles are only valid for uniform scaling, draw directly
+        this->drawGrid(painter, rect);
+        return;
+    }
+
+    // cached grid is only valid at one zoom
+    qreal zoom = transform.m11();
+    if (zoom != this->grid_tiles_zoom_) {
+        this->grid_tiles_.clear();
+        this->grid_tiles_zoom_ = zoom;
+    }
+
+    // range of tiles in screen pixels from scene origin
+    qint32 first_col = qFloor((rect.left() * zoom) / GRID_TILE_SIZE);
+    qint32 last_col = qFloor((rect.right() * zoom) / GRID_TILE_SIZE);
+    qint32 first_row = qFloor((rect.top() * zoom) / GRID_TILE_SIZE);
+    qint32 last_row = qFloor((rect.bottom() * zoom) / GRID_TILE_SIZE);
+
+    // blit tiles without scaling
+    painter->save();
+    painter->setTransform(QTransform::fromTranslate(transform.dx(),
+                                                    transform.dy()));
+    for (qint32 row = first_row; row <= last_row; row++) {
+        for (qint32 col = first_col; col <= last_col; col++) {
+            painter->drawPixmap(col * GRID_TILE_SIZE, row * GRID_TILE_SIZE,
+                                *this->getGridTile(col, row, zoom));
+        }
+    }
+    painter->restore();
+}
+
+QPixmap *Canvas::getGridTile(qint32 col, qint32 row, qreal zoom) {
+    quint64 key = (quint64(quint32(row)) << 32) | quint32(col);
+    QPixmap *tile = this->grid_tiles_.object(key);
+    if (!tile) {
+        tile = new QPixmap(GRID_TILE_SIZE, GRID_TILE_SIZE);
+        tile->fill(Qt::transparent);
+
+        // map scene to tile pixels
+        QPainter painter(tile);
+        painter.setRenderHint(QPainter::Antialiasing);
+        painter.translate(-col * GRID_TILE_SIZE, -row * GRID_TILE_SIZE);
+        painter.scale(zoom, zoom);
+
+        QRectF area(col * GRID_TILE_SIZE / zoom,
+                    row * GRID_TILE_SIZE / zoom,
+                    GRID_TILE_SIZE / zoom,
+                    GRID_TILE_SIZE / zoom);
+        this->drawGrid(&painter, area);
+        painter.end();
+
+        this->grid_tiles_.insert(key, tile);
+    }
+    return tile;
+}
+
+void Canvas::drawGrid(QPainter *painter, const QRectF &rect) {
     // Add grids proportional to scaling factor
     qreal scale = this->getScalingFactor();
     qint64 segment_size = GRID_SIZE;
@@ -189,34 +318,14 @@ void Canvas::drawBackground(QPainter *painter, const QRectF &rect) {
     painter->setPen(this->background_pen_);
     painter->setFont(this->font_);
 
-    // calculate position of background image
-    double width  = this->background_topright_y_
-            - this->background_bottomleft_y_;
-    double height = this->background_topright_x_
-            - this->background_bottomleft_x_;
-
-    QRectF bbox(this->background_bottomleft_y_*GRID_SIZE,
-                -this->background_topright_x_*GRID_SIZE,
-                width*GRID_SIZE,
-                height*GRID_SIZE);
-
-    // draw background image
-    painter->drawImage(bbox, this->background_image_);
-
-    // Draw vertical grid lines
-    for (qint32 i = 0; i <= right_bound; i += segment_size) {
-        painter->drawLine(i, top_bound, i, bot_bound);
-    }
-    for (qint32 i = 0; i >= left_bound; i -= segment_size) {
-        painter->drawLine(i, top_bound, i , bot_bound);
+    // Draw vertical grid lines, bounds are multiples of segment
+    for (qint64 i = left_bound; i <= right_bound; i += segment_size) {
+        painter->drawLine(QLineF(i, top_bound, i, bot_bound));
     }
 
     // Draw horizontal grid lines
-    for (qint32 i = 0; i <= bot_bound; i += segment_size) {
-        painter->drawLine(left_bound, i , right_bound, i);
-    }
-    for (qint32 i = 0; i >= top_bound; i -= segment_size) {
-        painter->drawLine(left_bound, i, right_bound, i);
+    for (qint64 i = top_bound; i <= bot_bound; i += segment_size) {
+        painter->drawLine(QLineF(left_bound, i, right_bound, i));
     }
 
     // Draw origin coordinate
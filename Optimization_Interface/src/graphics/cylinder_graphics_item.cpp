@@ -58,6 +58,9 @@ CylinderGraphicsItem::CylinderGraphicsItem(CylinderModelItem *model,
     // collision detection is iterative, value between
     // 0 and 1 balances precision with performance
     this->setBoundingRegionGranularity(0.9);
+
+    // Set area
+    this->updateGeometry();
 }
 
 CylinderGraphicsItem::~CylinderGraphicsItem() {
@@ -68,6 +71,20 @@ CylinderGraphicsItem::~CylinderGraphicsItem() {
 }
 
 QRectF CylinderGraphicsItem::boundingRect() const {
+    // cached area, see updateGeometry
+    return this->bounds_;
+}
+
+void CylinderGraphicsItem::updateGeometry() {
+    QRectF bounds = this->getBounds();
+    if (bounds != this->bounds_) {
+        // notify scene index before area changes
+        this->prepareGeometryChange();
+        this->bounds_ = bounds;
+    }
+}
+
+QRectF CylinderGraphicsItem::getBounds() const {
     qreal height = this->model_->getHeight();
     qreal width = this->model_->getWidth();
     qreal trigger_width = this->model_->getTriggerWidth();
@@ -191,6 +208,7 @@ void CylinderGraphicsItem::flipDirection() {
     // flip direction of keep out zone and re-render
     // not currently supported by socp
     this->model_->flipDirection();
+    this->updateGeometry();
     this->update(this->boundingRect());
 }
 
@@ -206,6 +224,10 @@ QVariant CylinderGraphicsItem::itemChange(GraphicsItemChange change,
         // check to expand the scene
         this->update(this->boundingRect());
     }
+    if (change == ItemSceneHasChanged) {
+        // area scales with zoom of new scene
+        this->updateGeometry();
+    }
     return QGraphicsItem::itemChange(change, value);
 }
 
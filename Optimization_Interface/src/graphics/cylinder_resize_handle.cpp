@@ -11,6 +11,7 @@
 #include <QGraphicsView>
 
 #include "include/globals.h"
+#include "include/graphics/cylinder_graphics_item.h"
 
 namespace optgui {
 
@@ -74,6 +75,9 @@ void CylinderResizeHandle::mouseMoveEvent(QGraphicsSceneMouseEvent *event) {
         this->model_->setRot(rotation);
         this->parentItem()->setRotation(rotation);
 
+        // parent area follows model
+        static_cast<CylinderGraphicsItem *>(
+                    this->parentItem())->updateGeometry();
         // re-render cylinder graphic
         this->update(this->boundingRect());
     }
@@ -40,9 +40,26 @@ DroneGraphicsItem::DroneGraphicsItem(DroneModelItem *model,
     QVector3D pos_3D = this->model_->getPos();
     QPointF pos_2D = QPointF(pos_3D.x(), pos_3D.y());
     this->setPos(pos_2D);
+
+    // Set area
+    this->updateGeometry();
 }
 
 QRectF DroneGraphicsItem::boundingRect() const {
+    // cached area, see updateGeometry
+    return this->bounds_;
+}
+
+void DroneGraphicsItem::updateGeometry() {
+    QRectF bounds = this->getBounds();
+    if (bounds != this->bounds_) {
+        // notify scene index before area changes
+        this->prepareGeometryChange();
+        this->bounds_ = bounds;
+    }
+}
+
+QRectF DroneGraphicsItem::getBounds() const {
     // return area of drawn shape
     return this->shape().boundingRect();
 }
@@ -137,6 +154,10 @@ QVariant DroneGraphicsItem::itemChange(GraphicsItemChange change,
         // check to expand the scene
         this->update(this->boundingRect());
     }
+    if (change == ItemSceneHasChanged) {
+        // area scales with zoom of new scene
+        this->updateGeometry();
+    }
     return QGraphicsItem::itemChange(change, value);
 }
 
@@ -58,6 +58,9 @@ EllipseGraphicsItem::EllipseGraphicsItem(EllipseModelItem *model,
     // collision detection is iterative, value between
     // 0 and 1 balances precision with performance
     this->setBoundingRegionGranularity(0.9);
+
+    // Set area
+    this->updateGeometry();
 }
 
 EllipseGraphicsItem::~EllipseGraphicsItem() {
@@ -68,6 +71,20 @@ EllipseGraphicsItem::~EllipseGraphicsItem() {
 }
 
 QRectF EllipseGraphicsItem::boundingRect() const {
+    // cached area, see updateGeometry
+    return this->bounds_;
+}
+
+void EllipseGraphicsItem::updateGeometry() {
+    QRectF bounds = this->getBounds();
+    if (bounds != this->bounds_) {
+        // notify scene index before area changes
+        this->prepareGeometryChange();
+        this->bounds_ = bounds;
+    }
+}
+
+QRectF EllipseGraphicsItem::getBounds() const {
     qreal height = this->model_->getHeight() +
             (this->model_->getClearance() * GRID_SIZE);
     qreal width = this->model_->getWidth() +
@@ -195,6 +212,7 @@ void EllipseGraphicsItem::flipDirection() {
     // flip direction of keep out zone and re-render
     // not currently supported by socp
     this->model_->flipDirection();
+    this->updateGeometry();
     this->update(this->boundingRect());
 }
 
@@ -210,6 +228,10 @@ QVariant EllipseGraphicsItem::itemChange(GraphicsItemChange change,
         // check to expand the scene
         this->update(this->boundingRect());
     }
+    if (change == ItemSceneHasChanged) {
+        // area scales with zoom of new scene
+        this->updateGeometry();
+    }
     return QGraphicsItem::itemChange(change, value);
 }
 
@@ -11,6 +11,7 @@
 #include <QGraphicsView>
 
 #include "include/globals.h"
+#include "include/graphics/ellipse_graphics_item.h"
 
 namespace optgui {
 
@@ -80,6 +81,9 @@ void EllipseResizeHandle::mouseMoveEvent(QGraphicsSceneMouseEvent *event) {
         this->model_->setRot(rotation);
         this->parentItem()->setRotation(rotation);
 
+        // parent area follows model
+        static_cast<EllipseGraphicsItem *>(
+                    this->parentItem())->updateGeometry();
         // re-render ellipse graphic
         this->update(this->boundingRect());
     }
@@ -0,0 +1,110 @@
+// TITLE:   Optimization_Interface/src/graphics/image_pyramid.cpp
+// AUTHORS: Daniel Sullivan
+// LAB:     Autonomous Controls Lab (ACL)
+// LICENSE: Copyright 2020, All Rights Reserved
+
+#include "include/graphics/image_pyramid.h"
+
+#include <QtMath>
+
+#include <cmath>
+
+namespace optgui {
+
+ImagePyramid::ImagePyramid() : tiles_(MAX_CACHED_TILES) {
+}
+
+void ImagePyramid::setImage(QImage const &image, QRectF const &area) {
+    this->levels_.clear();
+    this->tiles_.clear();
+    this->area_ = area;
+    if (image.isNull() || area.isEmpty()) {
+        return;
+    }
+
+    // premultiplied is the fastest format to convert to pixmaps
+    this->levels_.append(
+                image.convertToFormat(QImage::Format_ARGB32_Premultiplied));
+    // halve until one tile covers the image
+    while (this->levels_.last().width() > TILE_SIZE ||
+           this->levels_.last().height() > TILE_SIZE) {
+        QImage const &last = this->levels_.last();
+        this->levels_.append(last.scaled(qMax(last.width() / 2, 1),
+                                         qMax(last.height() / 2, 1),
+                                         Qt::IgnoreAspectRatio,
+                                         Qt::SmoothTransformation));
+    }
+}
+
+bool ImagePyramid::isNull() const {
+    return this->levels_.isEmpty();
+}
+
+void ImagePyramid::draw(QPainter *painter, QRectF const &rect,
+                        qreal scale) {
+    if (this->isNull()) {
+        return;
+    }
+    QRectF visible = rect.intersected(this->area_);
+    if (visible.isEmpty()) {
+        return;
+    }
+
+    int level = this->getLevel(scale);
+    QImage const &image = this->levels_.at(level);
+    // scene units per image pixel at level
+    qreal pixel_width = this->area_.width() / image.width();
+    qreal pixel_height = this->area_.height() / image.height();
+    qreal tile_width = TILE_SIZE * pixel_width;
+    qreal tile_height = TILE_SIZE * pixel_height;
+
+    // range of tiles overlapping visible area
+    int first_col = qFloor((visible.left() - this->area_.left()) /
+                           tile_width);
+    int last_col = qMin(qFloor((visible.right() - this->area_.left()) /
+                               tile_width),
+                        (image.width() - 1) / TILE_SIZE);
+    int first_row = qFloor((visible.top() - this->area_.top()) /
+                           tile_height);
+    int last_row = qMin(qFloor((visible.bottom() - this->area_.top()) /
+                               tile_height),
+                        (image.height() - 1) / TILE_SIZE);
+
+    for (int row = qMax(first_row, 0); row <= last_row; row++) {
+        for (int col = qMax(first_col, 0); col <= last_col; col++) {
+            QPixmap *tile = this->getTile(level, col, row);
+            QRectF target(this->area_.left() + (col * tile_width),
+                          this->area_.top() + (row * tile_height),
+                          tile->width() * pixel_width,
+                          tile->height() * pixel_height);
+            painter->drawPixmap(target, *tile, QRectF(tile->rect()));
+        }
+    }
+}
+
+int ImagePyramid::getLevel(qreal scale) const {
+    // image pixels per scene unit at full resolution
+    qreal density = this->levels_.first().width() / this->area_.width();
+    if (scale <= 0 || density <= scale) {
+        return 0;
+    }
+    // each level halves density
+    int level = qFloor(std::log2(density / scale));
+    return qBound(0, level, this->levels_.size() - 1);
+}
+
+QPixmap *ImagePyramid::getTile(int level, int col, int row) {
+    quint64 key = (quint64(level) << 48) |
+            (quint64(row) << 24) | quint64(col);
+    QPixmap *tile = this->tiles_.object(key);
+    if (!tile) {
+        QImage const &image = this->levels_.at(level);
+        QRect source = QRect(col * TILE_SIZE, row * TILE_SIZE,
+                             TILE_SIZE, TILE_SIZE).intersected(image.rect());
+        tile = new QPixmap(QPixmap::fromImage(image.copy(source)));
+        this->tiles_.insert(key, tile);
+    }
+    return tile;
+}
+
+}  // namespace optgui
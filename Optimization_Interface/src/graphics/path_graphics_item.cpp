@@ -21,24 +21,34 @@ PathGraphicsItem::PathGraphicsItem(PathModelItem *model,
     // Set pen
     this->pen_ = QPen(RED);
     this->pen_.setWidth(this->width_);
+    this->pen_.setJoinStyle(Qt::RoundJoin);
+    this->rgba_ = QColor(RED).rgba();
+    this->is_converging_ = 0;
 
-    // Set waypoints pen
+    // Set waypoints pen, round points are drawn as dots
     this->waypoints_pen_ = QPen(RED);
     this->waypoints_pen_.setWidth(2 * this->width_);
+    this->waypoints_pen_.setCapStyle(Qt::RoundCap);
+
+    // build shape on first update
+    this->shape_version_ = ~0ULL;
+    this->shape_scale_ = 0;
 
     // Set flags
     this->setFlags(QGraphicsItem::ItemSendsScenePositionChanges);
 }
 
 void PathGraphicsItem::setColor(QColor color) {
-    QMutexLocker(&this->mutex_);
-    this->pen_.setColor(color);
-    this->waypoints_pen_.setColor(color);
+    this->rgba_.store(color.rgba());
+}
+
+void PathGraphicsItem::setConverging(bool is_converging) {
+    this->is_converging_.store(is_converging ? 1 : 0);
 }
 
 QRectF PathGraphicsItem::boundingRect() const {
-    // return rough area of traj line
-    return this->shape().boundingRect();
+    // cached area, see updateGeometry
+    return this->bounds_;
 }
 
 void PathGraphicsItem::paint(QPainter *painter,
@@ -48,32 +58,60 @@ void PathGraphicsItem::paint(QPainter *painter,
     Q_UNUSED(option);
     Q_UNUSED(widget);
 
-    // Draw current traj
+    // frame whose area is indexed, newer frames wait for update
+    QVector<QPointF> const &points = this->model_->peekFrame().points;
+    int start = this->model_->getStart();
+    int size = points.size() - start;
+    if (size < 2) {
+        return;
+    }
+
+    // Set style from compute threads
+    QColor color = QColor::fromRgba(this->rgba_.load());
     qreal scaling_factor = this->getScalingFactor();
+    this->pen_.setColor(color);
+    this->pen_.setStyle(this->is_converging_.load() ?
+                            Qt::DashLine : Qt::SolidLine);
     this->pen_.setWidthF(this->width_ / scaling_factor);
-    quint32 size = this->model_->getSize();
-    for (quint32 i = 1; i < size; i++) {
-        painter->setPen(this->pen_);
-        QLineF line(mapFromScene(this->model_->getPointAt(i - 1)),
-                    mapFromScene(this->model_->getPointAt(i)));
-        painter->drawLine(line);
-
-        painter->setPen(this->waypoints_pen_);
-        painter->drawEllipse(this->model_->getPointAt(i), 0.5 * this->width_ / scaling_factor,
-                             0.5 * this->width_ / scaling_factor);
-    }
+    this->waypoints_pen_.setColor(color);
+    // same size as a stroked dot of radius half the line width
+    this->waypoints_pen_.setWidthF((this->width_ / scaling_factor) +
+                                   (2 * this->width_));
+
+    // Draw current traj, frame is stable while painting. Item is
+    // at scene origin so points need no mapping
+    painter->setPen(this->pen_);
+    painter->drawPolyline(points.constData() + start, size);
+
+    // Draw trajectory nodes after the first in one call
+    painter->setPen(this->waypoints_pen_);
+    painter->drawPoints(points.constData() + start + 1, size - 1);
 }
 
 QPainterPath PathGraphicsItem::shape() const {
     // return shape of traj line
-    QPainterPath path;
-    QPolygonF poly;
-    quint32 size = this->model_->getSize();
-    for (quint32 i = 0; i < size; i++) {
-        poly << this->model_->getPointAt(i);
+    return this->shape_;
+}
+
+void PathGraphicsItem::updateGeometry() {
+    quint64 version = this->model_->getVersion();
+    qreal scaling_factor = this->getScalingFactor();
+    if (version == this->shape_version_ &&
+            scaling_factor == this->shape_scale_) {
+        return;
     }
-    path.addPolygon(poly);
-    return path;
+    // notify scene index before area changes
+    this->prepareGeometryChange();
+    this->shape_ = QPainterPath();
+    this->shape_.addPolygon(QPolygonF(this->model_->getFrame().points.mid(
+                                          this->model_->getStart())));
+    // grow by half the widest pen so nodes are not clipped
+    qreal margin = ((this->width_ / scaling_factor) +
+                    (2 * this->width_)) / 2;
+    this->bounds_ = this->shape_.boundingRect().adjusted(
+                -margin, -margin, margin, margin);
+    this->shape_version_ = version;
+    this->shape_scale_ = scaling_factor;
 }
 
 QVariant PathGraphicsItem::itemChange(GraphicsItemChange change,
@@ -82,6 +120,10 @@ QVariant PathGraphicsItem::itemChange(GraphicsItemChange change,
         // check redraw
         this->update(this->boundingRect());
     }
+    if (change == ItemSceneHasChanged) {
+        // area scales with zoom of new scene
+        this->updateGeometry();
+    }
     return QGraphicsItem::itemChange(change, value);
 }
 
@@ -41,6 +41,9 @@ PlaneGraphicsItem::PlaneGraphicsItem(PlaneModelItem *model,
     //
     this->p1_handle_->hide();
     this->p2_handle_->hide();
+
+    // Set area
+    this->updateGeometry();
 }
 
 PlaneGraphicsItem::~PlaneGraphicsItem() {
@@ -50,6 +53,20 @@ PlaneGraphicsItem::~PlaneGraphicsItem() {
 }
 
 QRectF PlaneGraphicsItem::boundingRect() const {
+    // cached area, see updateGeometry
+    return this->bounds_;
+}
+
+void PlaneGraphicsItem::updateGeometry() {
+    QRectF bounds = this->getBounds();
+    if (bounds != this->bounds_) {
+        // notify scene index before area changes
+        this->prepareGeometryChange();
+        this->bounds_ = bounds;
+    }
+}
+
+QRectF PlaneGraphicsItem::getBounds() const {
     return this->shape().boundingRect();
 }
 
@@ -131,6 +148,7 @@ QPainterPath PlaneGraphicsItem::shape() const {
 
 void PlaneGraphicsItem::flipDirection() {
     this->model_->flipDirection();
+    this->updateGeometry();
     this->update(this->boundingRect());
 }
 
@@ -148,6 +166,10 @@ QVariant PlaneGraphicsItem::itemChange(GraphicsItemChange change,
         // check to redraw
         this->update(this->boundingRect());
     }
+    if (change == ItemSceneHasChanged) {
+        // area scales with zoom of new scene
+        this->updateGeometry();
+    }
     return QGraphicsItem::itemChange(change, value);
 }
 
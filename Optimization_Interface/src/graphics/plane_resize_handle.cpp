@@ -11,6 +11,7 @@
 #include <QGraphicsView>
 
 #include "include/globals.h"
+#include "include/graphics/plane_graphics_item.h"
 
 namespace optgui {
 
@@ -90,6 +91,9 @@ void PlaneResizeHandle::mouseMoveEvent(QGraphicsSceneMouseEvent *event) {
         } else {
             this->model_->setP1(eventPos);
         }
+        // parent area follows model
+        static_cast<PlaneGraphicsItem *>(
+                    this->parentItem())->updateGeometry();
         this->update(this->boundingRect());
     }
 }
@@ -36,9 +36,26 @@ PointGraphicsItem::PointGraphicsItem(PointModelItem *model,
 
     // Set position
     this->setPos(this->model_->getPos());
+
+    // Set area
+    this->updateGeometry();
 }
 
 QRectF PointGraphicsItem::boundingRect() const {
+    // cached area, see updateGeometry
+    return this->bounds_;
+}
+
+void PointGraphicsItem::updateGeometry() {
+    QRectF bounds = this->getBounds();
+    if (bounds != this->bounds_) {
+        // notify scene index before area changes
+        this->prepareGeometryChange();
+        this->bounds_ = bounds;
+    }
+}
+
+QRectF PointGraphicsItem::getBounds() const {
     // return area of point scaled by zoom factor
     qreal scaling_factor = this->getScalingFactor();
     qreal rad = this->radius_ / scaling_factor;
@@ -111,6 +128,10 @@ QVariant PointGraphicsItem::itemChange(GraphicsItemChange change,
         // check to redraw
         this->update(this->boundingRect());
     }
+    if (change == ItemSceneHasChanged) {
+        // area scales with zoom of new scene
+        this->updateGeometry();
+    }
     return QGraphicsItem::itemChange(change, value);
 }
 
@@ -40,6 +40,9 @@ PolygonGraphicsItem::PolygonGraphicsItem(PolygonModelItem *model,
         this->resize_handles_.append(handle);
         handle->hide();
     }
+
+    // Set area
+    this->updateGeometry();
 }
 
 PolygonGraphicsItem::~PolygonGraphicsItem() {
@@ -50,6 +53,20 @@ PolygonGraphicsItem::~PolygonGraphicsItem() {
 }
 
 QRectF PolygonGraphicsItem::boundingRect() const {
+    // cached area, see updateGeometry
+    return this->bounds_;
+}
+
+void PolygonGraphicsItem::updateGeometry() {
+    QRectF bounds = this->getBounds();
+    if (bounds != this->bounds_) {
+        // notify scene index before area changes
+        this->prepareGeometryChange();
+        this->bounds_ = bounds;
+    }
+}
+
+QRectF PolygonGraphicsItem::getBounds() const {
     // get rough area of polygon
     return this->shape().boundingRect();
 }
@@ -161,6 +178,7 @@ QPainterPath PolygonGraphicsItem::shape() const {
 void PolygonGraphicsItem::flipDirection() {
     // flip direction of keep out zone and re-render
     this->model_->flipDirection();
+    this->updateGeometry();
     this->update(this->boundingRect());
 }
 
@@ -179,6 +197,10 @@ QVariant PolygonGraphicsItem::itemChange(GraphicsItemChange change,
         // check to expand the scene
         this->update(this->boundingRect());
     }
+    if (change == ItemSceneHasChanged) {
+        // area scales with zoom of new scene
+        this->updateGeometry();
+    }
     return QGraphicsItem::itemChange(change, value);
 }
 
@@ -11,6 +11,7 @@
 #include <QGraphicsView>
 
 #include "include/globals.h"
+#include "include/graphics/polygon_graphics_item.h"
 
 namespace optgui {
 
@@ -77,6 +78,9 @@ void PolygonResizeHandle::mouseMoveEvent(QGraphicsSceneMouseEvent *event) {
         // update model with handle position and re-render
         QPointF eventPos = event->scenePos();
         this->model_->setPointAt(eventPos, this->index_);
+        // parent area follows model
+        static_cast<PolygonGraphicsItem *>(
+                    this->parentItem())->updateGeometry();
         this->update(this->boundingRect());
     }
 }
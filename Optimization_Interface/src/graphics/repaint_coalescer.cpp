@@ -0,0 +1,104 @@
+// TITLE:   Optimization_Interface/src/graphics/repaint_coalescer.cpp
+// AUTHORS: Daniel Sullivan
+// LAB:     Autonomous Controls Lab (ACL)
+// LICENSE: Copyright 2020, All Rights Reserved
+
+#include "include/graphics/repaint_coalescer.h"
+
+#include <QTextStream>
+
+namespace optgui {
+
+RepaintCoalescer::RepaintCoalescer(QGraphicsScene *scene, QObject *parent)
+    : QObject(parent) {
+    this->scene_ = scene;
+    this->flushes_ = 0;
+    this->repaints_ = 0;
+    this->painted_area_ = 0;
+    this->stats_clock_.start();
+}
+
+void RepaintCoalescer::removeItem(QGraphicsItem *item) {
+    this->pending_.remove(item);
+}
+
+void RepaintCoalescer::recordPaint(QRegion const &region) {
+    this->repaints_++;
+    for (QRect const &rect : region) {
+        this->painted_area_ += qreal(rect.width()) * rect.height();
+    }
+}
+
+QString RepaintCoalescer::takeStatsText() {
+    qreal elapsed = this->stats_clock_.restart() / 1000.0;
+    if (elapsed <= 0) {
+        return QString();
+    }
+
+    QString text;
+    QTextStream stream(&text);
+    stream.setRealNumberNotation(QTextStream::FixedNotation);
+    stream.setRealNumberPrecision(1);
+    stream << "repaints " << (this->repaints_ / elapsed) << "/s "
+           << (this->painted_area_ / elapsed / 1.0e6) << " Mpx/s" << endl;
+    stream << "flushes " << (this->flushes_ / elapsed) << "/s" << endl;
+
+    this->flushes_ = 0;
+    this->repaints_ = 0;
+    this->painted_area_ = 0;
+    return text;
+}
+
+void RepaintCoalescer::moveItem(QGraphicsItem *item, QPointF pos,
+                                qreal rotation) {
+    Pose &pose = this->pending_[item];
+    pose.pos = pos;
+    pose.rotation = rotation;
+}
+
+void RepaintCoalescer::flush() {
+    if (this->pending_.isEmpty()) {
+        return;
+    }
+
+    this->dirty_.resize(0);
+    for (auto it = this->pending_.constBegin();
+         it != this->pending_.constEnd(); it++) {
+        QGraphicsItem *item = it.key();
+        Pose const &pose = it.value();
+        if (item->pos() == pose.pos && item->rotation() == pose.rotation) {
+            continue;
+        }
+        QRectF old_bounds = item->sceneBoundingRect();
+        item->setPos(pose.pos);
+        item->setRotation(pose.rotation);
+        this->addDirty(old_bounds);
+        this->addDirty(item->sceneBoundingRect());
+    }
+    this->pending_.clear();
+
+    if (this->dirty_.isEmpty()) {
+        return;
+    }
+    this->flushes_++;
+    for (QRectF const &rect : this->dirty_) {
+        this->scene_->update(rect);
+    }
+}
+
+void RepaintCoalescer::addDirty(QRectF rect) {
+    // merged rect may now overlap others, keep merging until disjoint
+    int i = 0;
+    while (i < this->dirty_.size()) {
+        if (this->dirty_.at(i).intersects(rect)) {
+            rect |= this->dirty_.at(i);
+            this->dirty_.remove(i);
+            i = 0;
+        } else {
+            i++;
+        }
+    }
+    this->dirty_.append(rect);
+}
+
+}  // namespace optgui
@@ -13,6 +13,10 @@
 #include <QPushButton>
 #include <QCheckBox>
 #include <QMessageBox>
+#include <QFileDialog>
+#include <QFontDatabase>
+#include <QDate>
+#include <QSignalBlocker>
 
 #include "include/controls/compute_thread.h"
 
@@ -69,8 +73,8 @@ View::View(QWidget * parent)
     this->setHorizontalScrollBarPolicy(Qt::ScrollBarAlwaysOff);
     this->setResizeAnchor(QGraphicsView::AnchorViewCenter);
 
-    // Set rendering preference
-    this->setViewportUpdateMode(QGraphicsView::FullViewportUpdate);
+    // Set rendering preference, only repaint changed areas
+    this->setViewportUpdateMode(QGraphicsView::SmartViewportUpdate);
 
     // Set render hint
     this->setRenderHint(QPainter::Antialiasing);
@@ -168,6 +172,8 @@ void View::initializeMenuPanel() {
     this->initializeZoom(this->menu_panel_);
     // stage button
     this->initializeStageButton(this->menu_panel_);
+    // multiple trajectories
+    this->initializeCandidatesButton(this->menu_panel_);
 
     // add space at the bottom
     this->menu_panel_->menu_layout_->insertStretch(-1, 1);
@@ -175,6 +181,9 @@ void View::initializeMenuPanel() {
     // on fly update
     this->initializeTrajLockToggle(this->menu_panel_);
 
+    // replan during execution
+    this->initializeMpcToggle(this->menu_panel_);
+
     // on fly update
     this->initializeStageToggle(this->menu_panel_);
 
@@ -214,7 +223,10 @@ void View::initializeExpertPanel() {
     this->initializeSkyeFlyParamsTable(this->expert_panel_);
     this->expert_panel_->menu_layout_->insertStretch(-1, 1);
     this->initializeDataCaptureToggle(this->expert_panel_);
+    this->initializeSpatialIndexToggle(this->expert_panel_);
+    this->initializeSessionControls(this->expert_panel_);
     this->initializeModelParamsTable(this->expert_panel_);
+    this->initializeSolverStats(this->expert_panel_);
 
     // Connect menu open/close
     connect(this->expert_menu_button_, SIGNAL(clicked()),
@@ -404,6 +416,8 @@ void View::openExpertMenu() {
 void View::setZoom(qreal value) {
     // set zoom scaling factor
     this->setTransform(QTransform::fromScale(value, value));
+    // graphics are drawn at constant screen size
+    this->canvas_->updateGeometry();
 }
 
 void View::setState(STATE button_type) {
@@ -434,6 +448,7 @@ void View::execute() {
     // set to default state and try to execute staged traj
     this->clearMarkers();
     this->setState(IDLE);
+    this->controller_->recordEdit(SessionEvent::EXECUTE_EDIT);
     this->controller_->execute();
 }
 
@@ -441,6 +456,7 @@ void View::stageTraj() {
     // set to default state and try to stage traj
     this->clearMarkers();
     this->setState(IDLE);
+    this->controller_->recordEdit(SessionEvent::STAGE_EDIT);
     this->controller_->stageTraj();
 }
 
@@ -448,9 +464,17 @@ void View::unstageTraj() {
     // set to default state and try to unstage traj
     this->clearMarkers();
     this->setState(IDLE);
+    this->controller_->recordEdit(SessionEvent::UNSTAGE_EDIT);
     this->controller_->unstageTraj();
 }
 
+void View::generateCandidates() {
+    // set to default state and solve candidates for current drone
+    this->clearMarkers();
+    this->setState(IDLE);
+    this->controller_->generateCandidates();
+}
+
 void View::duplicateSelected() {
     // set to default state and try to duplicate selected ellipse
     this->clearMarkers();
@@ -460,13 +484,32 @@ void View::duplicateSelected() {
 
 void View::setFinaltime(qreal final_time) {
     // set final time
+    this->controller_->recordEdit(SessionEvent::FINAL_TIME_EDIT, final_time);
     this->controller_->setFinaltime(final_time);
 }
 
+void View::showFinaltime(qreal final_time) {
+    // not a manual change, do not set P.tf
+    QSignalBlocker blocker(this->finaltime_box_);
+    this->finaltime_box_->setValue(final_time);
+}
+
 void View::setClearance(qreal clearance) {
     this->controller_->setClearance(clearance);
 }
 
+void View::setReplanRate(qreal rate) {
+    this->controller_->setReplanRate(rate);
+}
+
+void View::setDeadline(qreal deadline) {
+    this->controller_->setDeadline(deadline);
+}
+
+void View::setAnytimeBudget(qreal budget) {
+    this->controller_->setAnytimeBudget(budget);
+}
+
 void View::setSkyeFlyParams() {
     // copy skyefly params from expert panel table to model
     this->controller_->setSkyeFlyParams(this->skyefly_params_table_);
@@ -488,6 +531,17 @@ void View::resizeEvent(QResizeEvent *event) {
     QGraphicsView::resizeEvent(event);
 }
 
+void View::paintEvent(QPaintEvent *event) {
+    QGraphicsView::paintEvent(event);
+    this->controller_->recordPaint(event->region());
+}
+
+void View::scrollContentsBy(int dx, int dy) {
+    QGraphicsView::scrollContentsBy(dx, dy);
+    // scrolled pixels would carry the scale bar with them
+    this->viewport()->update();
+}
+
 void View::expandView() {
     // Transpose view
     QRectF oldView = this->viewport()->rect();
@@ -1145,6 +1199,13 @@ void View::setCurrEndpoints() {
     bool point_found = false;
     bool drone_found = false;
     for (QGraphicsItem * item : items) {
+        if (item->type() == GRAPHICS_TYPE::CANDIDATE_GRAPHIC) {
+            // stage selected candidate traj
+            this->controller_->selectCandidate(
+                        qgraphicsitem_cast<CandidateGraphicsItem *>(item));
+            break;
+        }
+
         if (item->type() == GRAPHICS_TYPE::POINT_GRAPHIC && !point_found) {
             this->controller_->setCurrFinalPoint(
                         qgraphicsitem_cast<PointGraphicsItem *>(item)->model_);
@@ -1165,6 +1226,8 @@ void View::setCurrEndpoints() {
 
 void View::toggleSim(int state) {
     // toggle between simulate execution or actual execution
+    this->controller_->recordEdit(SessionEvent::SIMULATED_EDIT,
+                                  state == Qt::Checked);
     this->controller_->setSimulated(state == Qt::Checked);
 }
 
@@ -1174,10 +1237,27 @@ void View::toggleStage(int state) {
 }
 
 void View::toggleTrajLock(int state) {
+    this->controller_->recordEdit(SessionEvent::TRAJ_LOCK_EDIT,
+                                  state == Qt::Checked);
     this->controller_->setTrajLock(state == Qt::Checked);
 }
 
+void View::toggleMpc(int state) {
+    this->controller_->recordEdit(SessionEvent::MPC_EDIT,
+                                  state == Qt::Checked);
+    this->controller_->setMpcMode(state == Qt::Checked);
+}
+
 void View::toggleFreeFinalTime(int state) {
+    // fixed final time solves for time shown, which may be the
+    // last free final time solved
+    if (state != Qt::Checked) {
+        this->controller_->recordEdit(SessionEvent::FINAL_TIME_EDIT,
+                                      this->finaltime_box_->value());
+        this->controller_->setFinaltime(this->finaltime_box_->value());
+    }
+    this->controller_->recordEdit(SessionEvent::FREE_FINAL_TIME_EDIT,
+                                  state == Qt::Checked);
     this->controller_->setFreeFinalTime(state == Qt::Checked);
 }
 
@@ -1185,11 +1265,61 @@ void View::toggleDataCapture(int state) {
     this->controller_->setDataCapture(state == Qt::Checked);
 }
 
+void View::toggleSpatialIndex(int state) {
+    this->controller_->setSpatialIndex(state == Qt::Checked);
+}
+
+void View::toggleSessionRecording(int state) {
+    if (!this->controller_->setSessionRecording(state == Qt::Checked)) {
+        QMessageBox::warning(this, tr("Record Session"),
+                             tr("Could not create session file"));
+        this->session_record_toggle_->setCheckState(Qt::Unchecked);
+    }
+}
+
+void View::replaySession() {
+    QString filename = QFileDialog::getOpenFileName(
+                this, tr("Replay Session"), QString(),
+                tr("Session (*.session)"));
+    if (filename.isEmpty()) {
+        return;
+    }
+    if (!this->controller_->startReplay(
+                filename, this->fast_replay_toggle_->isChecked())) {
+        QMessageBox::warning(this, tr("Replay Session"),
+                             tr("Could not replay %1: %2").arg(
+                                 filename,
+                                 this->controller_->getReplayError()));
+    }
+}
+
+void View::updateSolverStats() {
+    this->solver_stats_label_->setText(
+                this->controller_->getSolverStatsText());
+}
+
+void View::dumpSolverStats() {
+    QString filename = QFileDialog::getSaveFileName(
+                this, tr("Save Solver Stats"),
+                QDate::currentDate().toString("'solver_stats_'MM_dd_yyyy'"),
+                tr("CSV (*.csv)"));
+    if (filename.isEmpty()) {
+        return;
+    }
+    if (!filename.endsWith(".csv")) {
+        filename.append(".csv");
+    }
+    if (!this->controller_->dumpSolverStats(filename)) {
+        QMessageBox::warning(this, tr("Solver Stats"),
+                             tr("Could not write %1").arg(filename));
+    }
+}
+
 void View::initializeModelParamsTable(MenuPanel *panel) {
     // Create table
     this->model_params_table_ = new QTableWidget(panel->menu_);
     this->model_params_table_->setColumnCount(1);  // fill with spinboxes
-    this->model_params_table_->setRowCount(1);  // how many params to edit
+    this->model_params_table_->setRowCount(4);  // how many params to edit
         // vertical headers are spinbox labels
     this->model_params_table_->verticalHeader()->setVisible(true);
     this->model_params_table_->verticalHeader()->
@@ -1202,7 +1332,7 @@ void View::initializeModelParamsTable(MenuPanel *panel) {
     this->model_params_table_->
             setVerticalScrollBarPolicy(Qt::ScrollBarAlwaysOff);
         // set size
-    this->model_params_table_->setMaximumHeight(30);
+    this->model_params_table_->setMaximumHeight(120);
         // add table to menu panel
     panel->menu_->layout()->addWidget(this->model_params_table_);
     panel->menu_->layout()->setAlignment(this->model_params_table_,
@@ -1222,6 +1352,84 @@ void View::initializeModelParamsTable(MenuPanel *panel) {
     this->model_params_table_->
             setVerticalHeaderItem(row_index, new QTableWidgetItem("clearance"));
     row_index++;
+
+    // replanning rate, 0 solves as fast as possible
+    QDoubleSpinBox *replan_rate =
+            new QDoubleSpinBox(this->model_params_table_);
+    replan_rate->setRange(0, 100);
+    replan_rate->setSingleStep(1);
+    replan_rate->setSuffix("Hz");
+    replan_rate->setValue(0);
+    replan_rate->setToolTip(tr("Replanning rate of current drone, "
+                               "all drones if none selected"));
+    connect(replan_rate, SIGNAL(valueChanged(double)),
+            this, SLOT(setReplanRate(double)));
+
+    this->model_params_table_->setCellWidget(row_index, 0, replan_rate);
+    this->model_params_table_->
+            setVerticalHeaderItem(row_index, new QTableWidgetItem("replan"));
+    row_index++;
+
+    // deadline after start of each period, 0 for end of period
+    QDoubleSpinBox *deadline = new QDoubleSpinBox(this->model_params_table_);
+    deadline->setRange(0, 1000);
+    deadline->setSingleStep(5);
+    deadline->setSuffix("ms");
+    deadline->setValue(0);
+    deadline->setToolTip(tr("Time to show result after start of each "
+                            "replanning period"));
+    connect(deadline, SIGNAL(valueChanged(double)),
+            this, SLOT(setDeadline(double)));
+
+    this->model_params_table_->setCellWidget(row_index, 0, deadline);
+    this->model_params_table_->
+            setVerticalHeaderItem(row_index, new QTableWidgetItem("deadline"));
+    row_index++;
+
+    // anytime budget, 0 solves each pass to completion
+    QDoubleSpinBox *anytime = new QDoubleSpinBox(this->model_params_table_);
+    anytime->setRange(0, 1000);
+    anytime->setSingleStep(5);
+    anytime->setSuffix("ms");
+    anytime->setValue(0);
+    anytime->setToolTip(tr("Show best solver iterate after this long, "
+                           "0 to wait for each solve"));
+    connect(anytime, SIGNAL(valueChanged(double)),
+            this, SLOT(setAnytimeBudget(double)));
+
+    this->model_params_table_->setCellWidget(row_index, 0, anytime);
+    this->model_params_table_->
+            setVerticalHeaderItem(row_index, new QTableWidgetItem("anytime"));
+    row_index++;
+}
+
+void View::initializeSolverStats(MenuPanel *panel) {
+    this->solver_stats_label_ = new QLabel(panel->menu_);
+    this->solver_stats_label_->setFont(
+                QFontDatabase::systemFont(QFontDatabase::FixedFont));
+    this->solver_stats_label_->setToolTip(
+                tr("Solve rate and latency percentiles per drone"));
+    panel->menu_->layout()->addWidget(this->solver_stats_label_);
+    panel->menu_->layout()->setAlignment(this->solver_stats_label_,
+                                        Qt::AlignBottom);
+
+    QPushButton *dump_button = new QPushButton("Dump Stats", panel->menu_);
+    dump_button->setToolTip(tr("Save solver latency histograms to csv"));
+    dump_button->setMinimumHeight(35);
+    panel->menu_->layout()->addWidget(dump_button);
+    panel->menu_->layout()->setAlignment(dump_button, Qt::AlignBottom);
+
+    this->panel_widgets_.append(this->solver_stats_label_);
+    this->panel_widgets_.append(dump_button);
+
+    connect(dump_button, SIGNAL(clicked(bool)),
+            this, SLOT(dumpSolverStats()));
+
+    // refresh once a second so rates are per second
+    this->solver_stats_timer_ = new QTimer(this);
+    connect(this->solver_stats_timer_, SIGNAL(timeout()),
+            this, SLOT(updateSolverStats()));
+    this->solver_stats_timer_->start(1000);
 }
 
 void View::initializeFinaltime(MenuPanel *panel) {
@@ -1250,11 +1458,10 @@ void View::initializeFinaltime(MenuPanel *panel) {
     this->panel_widgets_.append(opt_finaltime);
     this->panel_widgets_.append(opt_finaltime_label);
 
-    // free final time updates text box and P.tf
-    connect(this->controller_, SIGNAL(finalTime(double)),
-            this, SLOT(setFinaltime(qreal)));
+    // free final time updates text box only
+    this->finaltime_box_ = opt_finaltime;
     connect(this->controller_, SIGNAL(finalTime(double)),
-            opt_finaltime, SLOT(setValue(qreal)));
+            this, SLOT(showFinaltime(qreal)));
     // manual change updates P.tf
     connect(opt_finaltime, SIGNAL(valueChanged(double)),
             this, SLOT(setFinaltime(qreal)));
@@ -1312,6 +1519,22 @@ void View::initializeTrajLockToggle(MenuPanel *panel) {
             this, SLOT(toggleTrajLock(int)));
 }
 
+void View::initializeMpcToggle(MenuPanel *panel) {
+    QCheckBox *mpc_toggle = new QCheckBox("MPC", panel->menu_);
+    mpc_toggle->
+            setToolTip(tr("Replan Executed Trajectory from Telemetry"));
+    mpc_toggle->setMinimumHeight(35);
+    mpc_toggle->setCheckState(Qt::Unchecked);
+    panel->menu_->layout()->addWidget(mpc_toggle);
+    panel->menu_->layout()->setAlignment(mpc_toggle, Qt::AlignBottom);
+
+    this->panel_widgets_.append(mpc_toggle);
+
+    // Connect toggle
+    connect(mpc_toggle, SIGNAL(stateChanged(int)),
+            this, SLOT(toggleMpc(int)));
+}
+
 void View::initializeDataCaptureToggle(MenuPanel *panel) {
     QCheckBox *data_capture_toggle =
             new QCheckBox("Data Capture", panel->menu_);
@@ -1330,6 +1553,62 @@ void View::initializeDataCaptureToggle(MenuPanel *panel) {
             this, SLOT(toggleDataCapture(int)));
 }
 
+void View::initializeSpatialIndexToggle(MenuPanel *panel) {
+    QCheckBox *spatial_index_toggle =
+            new QCheckBox("Spatial Index", panel->menu_);
+    spatial_index_toggle->
+            setToolTip(tr("Index graphics for faster selection and drawing"));
+    spatial_index_toggle->setMinimumHeight(35);
+    spatial_index_toggle->setCheckState(Qt::Checked);
+    panel->menu_->layout()->addWidget(spatial_index_toggle);
+    panel->menu_->layout()->setAlignment(
+                spatial_index_toggle, Qt::AlignBottom);
+
+    this->panel_widgets_.append(spatial_index_toggle);
+
+    // Connect toggle
+    connect(spatial_index_toggle, SIGNAL(stateChanged(int)),
+            this, SLOT(toggleSpatialIndex(int)));
+}
+
+void View::initializeSessionControls(MenuPanel *panel) {
+    this->session_record_toggle_ =
+            new QCheckBox("Record Session", panel->menu_);
+    this->session_record_toggle_->
+            setToolTip(tr("Save telemetry and edits for replay"));
+    this->session_record_toggle_->setMinimumHeight(35);
+    this->session_record_toggle_->setCheckState(Qt::Unchecked);
+    panel->menu_->layout()->addWidget(this->session_record_toggle_);
+    panel->menu_->layout()->setAlignment(
+                this->session_record_toggle_, Qt::AlignBottom);
+
+    this->fast_replay_toggle_ = new QCheckBox("Fast Replay", panel->menu_);
+    this->fast_replay_toggle_->
+            setToolTip(tr("Replay sessions as fast as possible"));
+    this->fast_replay_toggle_->setMinimumHeight(35);
+    this->fast_replay_toggle_->setCheckState(Qt::Unchecked);
+    panel->menu_->layout()->addWidget(this->fast_replay_toggle_);
+    panel->menu_->layout()->setAlignment(
+                this->fast_replay_toggle_, Qt::AlignBottom);
+
+    QPushButton *replay_button = new QPushButton("Replay", panel->menu_);
+    replay_button->setToolTip(
+                tr("Play a session recorded with the loaded config"));
+    replay_button->setMinimumHeight(35);
+    panel->menu_->layout()->addWidget(replay_button);
+    panel->menu_->layout()->setAlignment(replay_button, Qt::AlignBottom);
+
+    this->panel_widgets_.append(this->session_record_toggle_);
+    this->panel_widgets_.append(this->fast_replay_toggle_);
+    this->panel_widgets_.append(replay_button);
+
+    // Connect toggle and button
+    connect(this->session_record_toggle_, SIGNAL(stateChanged(int)),
+            this, SLOT(toggleSessionRecording(int)));
+    connect(replay_button, SIGNAL(clicked(bool)),
+            this, SLOT(replaySession()));
+}
+
 void View::initializeFreeFinalTimeToggle(MenuPanel *panel) {
     QCheckBox *free_final_time_toggle =
             new QCheckBox("Free Final Time", panel->menu_);
@@ -1389,6 +1668,22 @@ void View::initializeStageButton(MenuPanel *panel) {
             this, SLOT(unstageTraj()));
 }
 
+void View::initializeCandidatesButton(MenuPanel *panel) {
+    QPushButton *candidates_button =
+            new QPushButton("Candidates", panel->menu_);
+    candidates_button->
+            setToolTip(tr("Solve multiple trajectories to choose from"));
+    candidates_button->setMinimumHeight(35);
+    panel->menu_->layout()->addWidget(candidates_button);
+    panel->menu_->layout()->
+            setAlignment(candidates_button, Qt::AlignBottom);
+
+    this->panel_widgets_.append(candidates_button);
+
+    connect(candidates_button, SIGNAL(clicked(bool)),
+            this, SLOT(generateCandidates()));
+}
+
 void View::initializeDuplicateButton(MenuPanel *panel) {
     QPushButton *duplicate_button = new QPushButton("Duplicate", panel->menu_);
     duplicate_button->setToolTip(tr("Duplicate Selected Constraint"));
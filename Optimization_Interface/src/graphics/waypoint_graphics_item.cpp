@@ -40,9 +40,26 @@ WaypointGraphicsItem::WaypointGraphicsItem(PointModelItem *model,
 
     // Set position
     this->setPos(this->model_->getPos());
+
+    // Set area
+    this->updateGeometry();
 }
 
 QRectF WaypointGraphicsItem::boundingRect() const {
+    // cached area, see updateGeometry
+    return this->bounds_;
+}
+
+void WaypointGraphicsItem::updateGeometry() {
+    QRectF bounds = this->getBounds();
+    if (bounds != this->bounds_) {
+        // notify scene index before area changes
+        this->prepareGeometryChange();
+        this->bounds_ = bounds;
+    }
+}
+
+QRectF WaypointGraphicsItem::getBounds() const {
     // get rough area circle scaled by zoom factor
     qreal scaling_factor = this->getScalingFactor();
     qreal rad = this->radius_ / scaling_factor;
@@ -130,6 +147,10 @@ QVariant WaypointGraphicsItem::itemChange(GraphicsItemChange change,
         // redraw graphic
         this->update(this->boundingRect());
     }
+    if (change == ItemSceneHasChanged) {
+        // area scales with zoom of new scene
+        this->updateGeometry();
+    }
     return QGraphicsItem::itemChange(change, value);
 }
 
@@ -0,0 +1,121 @@
+// TITLE:   Optimization_Interface/src/log2csv_main.cpp
+// AUTHORS: Daniel Sullivan
+// LAB:     Autonomous Controls Lab (ACL)
+// LICENSE: Copyright 2020, All Rights Reserved
+
+// Converts binary flight logs to the csv columns written by the GUI
+
+#include <QCoreApplication>
+#include <QCommandLineParser>
+#include <QDateTime>
+#include <QFile>
+#include <QFileInfo>
+#include <QDir>
+#include <QTextStream>
+#include <QVector>
+
+#include "include/controls/flight_log.h"
+
+// reference minus telemetry of same quantity
+static double getDiff(optgui::FlightRecord const &record, int ref_index) {
+    return record.values[ref_index] - record.values[ref_index + 9];
+}
+
+static bool convert(QString const &input, QString const &output,
+                    QTextStream *err) {
+    QFile in_file(input);
+    if (!in_file.open(QIODevice::ReadOnly)) {
+        *err << input << ": " << in_file.errorString() << endl;
+        return false;
+    }
+    optgui::FlightLogReader reader;
+    if (!reader.open(&in_file)) {
+        *err << input << ": " << reader.getError() << endl;
+        return false;
+    }
+
+    QFile out_file(output);
+    if (!out_file.open(QIODevice::WriteOnly | QIODevice::Text)) {
+        *err << output << ": " << out_file.errorString() << endl;
+        return false;
+    }
+    QTextStream stream(&out_file);
+
+    stream << "abs_time,rel_time,"
+
+           << "pos_ref_n,pos_ref_e,pos_ref_d,"
+           << "vel_ref_n,vel_ref_e,vel_ref_d,"
+           << "accl_ref_n,accl_ref_e,accl_ref_d,"
+
+           << "pos_telem_n,pos_telem_e,pos_telem_d,"
+           << "vel_telem_n,vel_telem_e,vel_telem_d,"
+           << "accl_telem_n,accl_telem_e,accl_telem_d,"
+
+           << "pos_diff_n,pos_diff_e,pos_diff_d,"
+           << "vel_diff_n,vel_diff_e,vel_diff_d,"
+           << "accl_diff_n,accl_diff_e,accl_diff_d"
+
+           << endl;
+
+    QVector<optgui::FlightRecord> records;
+    while (reader.readBlock(&records)) {
+        for (optgui::FlightRecord const &record : records) {
+            // time
+            stream << QDateTime::fromMSecsSinceEpoch(record.abs_time)
+                      .toString("hh.mm.ss");
+
+            // rel_time, ref and telem
+            for (int i = 0; i < optgui::FlightRecord::NUM_VALUES; i++) {
+                stream << "," << record.values[i];
+            }
+
+            // diff, ref starts after rel_time
+            for (int i = 1; i < 10; i++) {
+                stream << "," << getDiff(record, i);
+            }
+
+            stream << endl;
+        }
+    }
+    if (!reader.getError().isEmpty()) {
+        // rows before the bad block are kept
+        *err << input << ": " << reader.getError() << endl;
+        return false;
+    }
+    return true;
+}
+
+int main(int argc, char *argv[]) {
+    QCoreApplication app(argc, argv);
+    QCoreApplication::setApplicationName("optgui_log2csv");
+
+    QCommandLineParser parser;
+    parser.setApplicationDescription(
+                "Convert flight logs to csv, one csv per log");
+    parser.addHelpOption();
+    parser.addPositionalArgument("logs", "Flight logs to convert",
+                                 "<log>...");
+    QCommandLineOption output_option(
+                QStringList() << "o" << "output",
+                "Output directory, default next to each log.", "dir");
+    parser.addOption(output_option);
+    parser.process(app);
+
+    QStringList inputs = parser.positionalArguments();
+    if (inputs.isEmpty()) {
+        parser.showHelp(1);
+    }
+
+    QTextStream err(stderr);
+    int failed = 0;
+    for (QString const &input : inputs) {
+        QFileInfo info(input);
+        QDir dir = parser.isSet(output_option) ?
+                    QDir(parser.value(output_option)) : info.dir();
+        QString output = dir.filePath(info.completeBaseName() + ".csv");
+        if (!convert(input, output, &err)) {
+            failed++;
+        }
+    }
+    return failed > 0 ? 1 : 0;
+}
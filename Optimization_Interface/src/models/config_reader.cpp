@@ -0,0 +1,165 @@
+// TITLE:   Optimization_Interface/src/models/config_reader.cpp
+// AUTHORS: Daniel Sullivan, Miki Szmuk
+// LAB:     Autonomous Controls Lab (ACL)
+// LICENSE: Copyright 2020, All Rights Reserved
+
+#include "include/models/config_reader.h"
+
+#include <QFile>
+#include <QTextStream>
+#include <QRegExp>
+#include <QStringList>
+
+namespace optgui {
+
+bool ConfigReader::readConfig(QString const &file_name,
+                              ConstraintModel *model,
+                              QString *error) {
+    QFile file(file_name);
+
+    if (!file.open(QIODevice::ReadOnly)) {
+        *error = file.errorString();
+        return false;
+    }
+
+    // Parameters of current item
+    qreal wid = 0;
+    qreal hei = 0;
+    qreal rot = 0;
+    qreal trigwid = 0;
+    QPointF pos;
+    qreal cle = 0;
+    quint16 por = 0;
+
+    // Variables for stepping through file
+    QTextStream in(&file);
+    QRegExp separator("[:,]");
+    // Variables to keep track of current item
+    char new_item_type = 0;
+    char old_item_type = 0;
+    bool new_item = 1;
+    // Polygon vertices variable
+    QVector<QPointF> vertices;
+
+    // Step through config file
+    while (!in.atEnd()) {
+        // Read current line
+        QStringList line = in.readLine().split(separator);
+
+        if (line[0] == "")
+            continue;
+
+        // First check if new item
+        if (line[0] == "Ellipse") {
+            new_item_type = 'e';
+            new_item = !new_item;
+            continue;
+        } else if (line[0] == "Cylinder") {
+            new_item_type = 'c';
+            new_item = !new_item;
+            continue;
+        } else if (line[0] == "Waypoints") {
+            new_item_type = 'w';
+            new_item = !new_item;
+            continue;
+        } else if (line[0] == "Polygons") {
+            new_item_type = 'p';
+            new_item = !new_item;
+            continue;
+        } else if (line[0] == "Final Points") {
+            new_item_type = 'f';
+            new_item = !new_item;
+            continue;
+        } else if (line[0] == "Drone") {
+            new_item_type = 'd';
+            new_item = !new_item;
+            continue;
+        } else if (line[0] == "End") {
+            new_item = !new_item;
+        }
+
+        // If old_item_type is null, set it
+        if (old_item_type == 0) {
+            old_item_type = new_item_type;
+        }
+
+        // If new item, add last item to model
+        if (new_item) {
+            if (old_item_type == 'e') {
+                // create new data model
+                EllipseModelItem *item_model =
+                        new EllipseModelItem(pos, cle, hei, wid, rot);
+                if (por != 0)
+                    item_model->port_ = por;
+                // save to model
+                model->addEllipse(item_model);
+            } else if (old_item_type == 'c') {
+                // create new data model
+                CylinderModelItem *item_model =
+                        new CylinderModelItem(pos, cle, hei, wid,
+                                              trigwid, rot);
+                if (por != 0)
+                    item_model->port_ = por;
+                // save to model
+                model->addCylinder(item_model);
+            } else if (old_item_type == 'w') {
+                // create new data model
+                PointModelItem *item_model = new PointModelItem(pos);
+                if (por != 0)
+                    item_model->port_ = por;
+                // save to model
+                model->addWaypoint(item_model);
+            } else if (old_item_type == 'p') {
+                // create new data model
+                PolygonModelItem *item_model =
+                        new PolygonModelItem(vertices);
+                if (por != 0)
+                    item_model->port_ = por;
+                // save to model
+                model->addPolygon(item_model);
+            } else if (old_item_type == 'f') {
+                // create new data model
+                PointModelItem *item_model = new PointModelItem(pos);
+                if (por != 0)
+                    item_model->port_ = por;
+                // save to model
+                model->addPoint(item_model);
+            } else if (old_item_type == 'd') {
+                // create new data model, model owns traj
+                DroneModelItem *item_model = new DroneModelItem(pos);
+                PathModelItem *traj = new PathModelItem();
+                if (por != 0)
+                    item_model->port_ = por;
+                // save to model
+                model->addDrone(item_model, traj);
+            }
+            new_item = 0;
+            old_item_type = new_item_type;
+        }
+
+        // Store item parameters
+        if (line[0].contains("Position")) {
+            pos = QPoint(line[1].toDouble(), line[2].toDouble());
+        } else if (line[0].contains("Height")) {
+            hei = line[1].toDouble();
+        } else if (line[0].contains("Rotation")) {
+            rot = line[1].toDouble();
+        } else if (line[0].contains("Trigger Width")) {
+            trigwid = line[1].toDouble();
+        } else if (line[0].contains("Width")) {
+            wid = line[1].toDouble();
+        } else if (line[0].contains("Clearance")) {
+            cle = line[1].toDouble();
+        } else if (line[0].contains("Port")) {
+            por = line[1].toDouble();
+        } else if (line[0].contains("Vertex")) {
+            pos = QPointF(line[1].toDouble(), line[2].toDouble());
+            vertices.append(pos);
+        }
+    }
+
+    file.close();
+    return true;
+}
+
+}  // namespace optgui
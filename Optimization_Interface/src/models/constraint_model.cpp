@@ -18,7 +18,8 @@
 
 namespace optgui {
 
-ConstraintModel::ConstraintModel() : model_lock_(), P_() {
+ConstraintModel::ConstraintModel() : model_lock_(),
+    change_lock_(), change_cond_(), P_() {
     // Set model containers
     this->curr_drone_ = nullptr;
     this->staged_drone_ = nullptr;
@@ -35,7 +36,16 @@ ConstraintModel::ConstraintModel() : model_lock_(), P_() {
     // initialize live reference mode to disable updating
     // current trajectory
     this->is_live_reference_ = false;
+    this->is_mpc_ = false;
     this->is_free_final_time_ = false;
+
+    // no changes yet
+    this->change_count_ = 0;
+    this->model_version_ = 0;
+    this->published_version_ = 0;
+
+    // solvers always find a snapshot
+    this->publishSnapshot();
 }
 
 ConstraintModel::~ConstraintModel() {
@@ -70,11 +80,10 @@ ConstraintModel::~ConstraintModel() {
         delete this->path_staged_;
     }
     // Delete drones and associated traj
-    for ( QMap<DroneModelItem *, QPair<PathModelItem *,
-          autogen::packet::traj2dof>>::iterator iter = this->drones_.begin();
-         iter != this->drones_.end(); iter++) {
+    for (QMap<DroneModelItem *, PathModelItem *>::iterator iter =
+         this->drones_.begin(); iter != this->drones_.end(); iter++) {
         delete iter.key();  // delete drone
-        delete iter.value().first;  // delete path
+        delete iter.value();  // delete path
     }
 
     // Delete final points
@@ -88,11 +97,16 @@ ConstraintModel::~ConstraintModel() {
 void ConstraintModel::addPoint(PointModelItem *item) {
     QMutexLocker locker(&this->model_lock_);
     this->final_points_.insert(item);
+    // final points only affect drones targeting them
+    item->setListener(this, false);
+    this->notifyChange();
 }
 
 void ConstraintModel::removePoint(PointModelItem *item) {
     QMutexLocker locker(&this->model_lock_);
     this->final_points_.remove(item);
+    item->setListener(nullptr, false);
+    this->notifyChange();
 }
 
 QSet<PointModelItem *> ConstraintModel::getPoints() {
@@ -101,9 +115,9 @@ QSet<PointModelItem *> ConstraintModel::getPoints() {
 
 void ConstraintModel::addDrone(DroneModelItem *drone, PathModelItem *traj) {
     QMutexLocker locker(&this->model_lock_);
-    this->drones_.insert(drone,
-                         QPair<PathModelItem *, autogen::packet::traj2dof>
-                                (traj, autogen::packet::traj2dof()));
+    this->drones_.insert(drone, traj);
+    drone->setListener(this, false);
+    this->notifyChange();
 }
 
 void ConstraintModel::removeDrone(DroneModelItem *item) {
@@ -113,6 +127,8 @@ void ConstraintModel::removeDrone(DroneModelItem *item) {
         this->curr_drone_ = nullptr;
     }
     this->drones_.remove(item);
+    item->setListener(nullptr, false);
+    this->notifyChange();
 }
 
 DroneModelItem* ConstraintModel::getDrones(){
@@ -125,12 +141,20 @@ DroneModelItem* ConstraintModel::getDrones(){
 void ConstraintModel::addEllipse(EllipseModelItem *item) {
     QMutexLocker locker(&this->model_lock_);
     this->ellipses_.push_back(item);
+    this->ellipse_store_.append();
+    this->obstacle_index_.addEllipse(item);
+    item->setListener(this, true);
+    this->bumpModelVersion();
 }
 
 void ConstraintModel::removeEllipse(EllipseModelItem *item) {
     QMutexLocker locker(&this->model_lock_);
     int idx = this->ellipses_.indexOf(item);
     this->ellipses_.remove(idx);
+    this->ellipse_store_.remove(idx);
+    this->obstacle_index_.remove(item);
+    item->setListener(nullptr, false);
+    this->bumpModelVersion();
 }
 
 QVector<EllipseModelItem *> ConstraintModel::getEllipses(){
@@ -140,12 +164,18 @@ QVector<EllipseModelItem *> ConstraintModel::getEllipses(){
 void ConstraintModel::addCylinder(CylinderModelItem *item) {
     QMutexLocker locker(&this->model_lock_);
     this->cylinders_.push_back(item);
+    this->obstacle_index_.addCylinder(item);
+    item->setListener(this, true);
+    this->bumpModelVersion();
 }
 
 void ConstraintModel::removeCylinder(CylinderModelItem *item) {
     QMutexLocker locker(&this->model_lock_);
     int idx = this->cylinders_.indexOf(item);
     this->cylinders_.remove(idx);
+    this->obstacle_index_.remove(item);
+    item->setListener(nullptr, false);
+    this->bumpModelVersion();
 }
 
 QVector<CylinderModelItem *> ConstraintModel::getCylinders(){
@@ -155,11 +185,15 @@ QVector<CylinderModelItem *> ConstraintModel::getCylinders(){
 void ConstraintModel::addPolygon(PolygonModelItem *item) {
     QMutexLocker locker(&this->model_lock_);
     this->polygons_.insert(item);
+    item->setListener(this, true);
+    this->bumpModelVersion();
 }
 
 void ConstraintModel::removePolygon(PolygonModelItem *item) {
     QMutexLocker locker(&this->model_lock_);
     this->polygons_.remove(item);
+    item->setListener(nullptr, false);
+    this->bumpModelVersion();
 }
 
 QSet<PolygonModelItem *> ConstraintModel::getPolygons() {
@@ -169,21 +203,29 @@ QSet<PolygonModelItem *> ConstraintModel::getPolygons() {
 void ConstraintModel::addPlane(PlaneModelItem *item) {
     QMutexLocker locker(&this->model_lock_);
     this->planes_.insert(item);
+    item->setListener(this, true);
+    this->bumpModelVersion();
 }
 
 void ConstraintModel::removePlane(PlaneModelItem *item) {
     QMutexLocker locker(&this->model_lock_);
     this->planes_.remove(item);
+    item->setListener(nullptr, false);
+    this->bumpModelVersion();
 }
 
 void ConstraintModel::addWaypoint(PointModelItem *item) {
     QMutexLocker locker(&this->model_lock_);
     this->waypoints_.append(item);
+    item->setListener(this, true);
+    this->bumpModelVersion();
 }
 
 void ConstraintModel::removeWaypoint(PointModelItem *item) {
     QMutexLocker locker(&this->model_lock_);
     this->waypoints_.removeOne(item);
+    item->setListener(nullptr, false);
+    this->bumpModelVersion();
 }
 
 quint32 ConstraintModel::getNumWaypoints() {
@@ -195,6 +237,7 @@ quint32 ConstraintModel::getNumWaypoints() {
 void ConstraintModel::reverseWaypoints() {
     QMutexLocker locker(&this->model_lock_);
     std::reverse(this->waypoints_.begin(), this->waypoints_.end());
+    this->bumpModelVersion();
 }
 
 QVector<PointModelItem *> ConstraintModel::getWaypoints(){
@@ -216,14 +259,15 @@ void ConstraintModel::setPathStagedPoints(QVector<QPointF> points) {
     }
 }
 
-bool ConstraintModel::tickPathStaged() {
+bool ConstraintModel::setPathStagedIndex(int index) {
     QMutexLocker locker(&this->model_lock_);
-    // remove first point
-    if (this->path_staged_) {
-        this->path_staged_->removePointAt(0);
+    if (!this->path_staged_ ||
+            index >= static_cast<int>(this->path_staged_->getSize())) {
+        return false;
     }
-    // return whether there are more points
-    return this->path_staged_->getSize() != 0;
+    // points stay in place, only start moves
+    this->path_staged_->setStart(index);
+    return true;
 }
 
 void ConstraintModel::clearPathStagedPoints() {
@@ -237,7 +281,8 @@ QVector<QPointF> ConstraintModel::getPathStagedPoints() {
     QMutexLocker locker(&this->model_lock_);
     QVector<QPointF> temp;
     if (this->path_staged_) {
-        temp = this->path_staged_->getPoints();
+        temp = this->path_staged_->getPoints().mid(
+                    this->path_staged_->getStart());
     }
     return temp;
 }
@@ -257,39 +302,31 @@ qreal ConstraintModel::getFinaltime() {
 
 void ConstraintModel::setFinaltime(qreal finaltime) {
     QMutexLocker locker(&this->model_lock_);
+    // unchanged time would force every context to solve again
+    if (this->P_.tf == finaltime) {
+        return;
+    }
     this->P_.tf = finaltime;
+    this->bumpModelVersion();
 }
 
-autogen::packet::traj2dof
+autogen::packet::traj2dof const &
         ConstraintModel::getCurrTraj2dof(DroneModelItem *drone) {
+    static autogen::packet::traj2dof const empty_traj2dof;
     QMutexLocker locker(&this->model_lock_);
     // find drone
-    QMap<DroneModelItem *, QPair<PathModelItem *,
-            autogen::packet::traj2dof>>::iterator iter =
-            this->drones_.find(drone);
-    if (iter != this->drones_.end()) {
-        // get traj2dof for drone
-        return (*iter).second;
-    }
-    return autogen::packet::traj2dof();
-}
-
-void ConstraintModel::setCurrTraj2dof(DroneModelItem *drone,
-                                     autogen::packet::traj2dof traj2dof_data) {
-    QMutexLocker locker(&this->model_lock_);
-    // find drone
-    QMap<DroneModelItem *, QPair<PathModelItem *,
-            autogen::packet::traj2dof>>::iterator iter =
+    QMap<DroneModelItem *, PathModelItem *>::iterator iter =
             this->drones_.find(drone);
     if (iter != this->drones_.end()) {
-        // set traj2dof for drone
-        (*iter).second = traj2dof_data;
+        // get traj2dof of latest solve for drone
+        return (*iter)->getFrame().traj2dof;
     }
+    return empty_traj2dof;
 }
 
-autogen::packet::traj2dof ConstraintModel::getStagedTraj2dof() {
+autogen::packet::traj2dof const &ConstraintModel::getStagedTraj2dof() {
     QMutexLocker locker(&this->model_lock_);
-    return this->drone_staged_traj2dof_data_;
+    return this->path_staged_->getFrame().traj2dof;
 }
 
 DroneModelItem *ConstraintModel::getStagedDrone() {
@@ -303,17 +340,26 @@ void ConstraintModel::stageTraj() {
         // set drone to staged drone
         this->staged_drone_ = this->curr_drone_;
         // find drone
-        QMap<DroneModelItem *, QPair<PathModelItem *,
-                autogen::packet::traj2dof>>::iterator iter =
+        QMap<DroneModelItem *, PathModelItem *>::iterator iter =
                 this->drones_.find(this->curr_drone_);
         if (iter != this->drones_.end()) {
-            this->drone_staged_traj2dof_data_ = (*iter).second;
-            this->path_staged_->setPoints((*iter).first->getPoints());
+            // staged copy stays fixed while drone keeps solving
+            this->path_staged_->setFrame((*iter)->getFrame());
             this->traj_staged_ = true;
         }
     }
 }
 
+void ConstraintModel::stageTraj(DroneModelItem *drone,
+                                TrajectoryFrame const &frame) {
+    QMutexLocker locker(&this->model_lock_);
+    if (this->drones_.contains(drone)) {
+        this->staged_drone_ = drone;
+        this->path_staged_->setFrame(frame);
+        this->traj_staged_ = true;
+    }
+}
+
 void ConstraintModel::unstageTraj() {
     QMutexLocker locker(&this->model_lock_);
     this->path_staged_->clearPoints();
@@ -341,6 +387,7 @@ void ConstraintModel::setClearance(qreal clearance) {
         ellipse->setClearance(clearance);
     }
     this->clearance_ = clearance;
+    this->bumpModelVersion();
 }
 
 quint32 ConstraintModel::getHorizon() {
@@ -351,6 +398,7 @@ quint32 ConstraintModel::getHorizon() {
 void ConstraintModel::setHorizon(quint32 horizon) {
     QMutexLocker locker(&this->model_lock_);
     this->P_.K = horizon;
+    this->bumpModelVersion();
 }
 
 bool ConstraintModel::isLiveReference() {
@@ -361,6 +409,25 @@ bool ConstraintModel::isLiveReference() {
 void ConstraintModel::setLiveReferenceMode(bool reference_mode) {
     QMutexLocker locker(&this->model_lock_);
     this->is_live_reference_ = reference_mode;
+    this->bumpModelVersion();
+}
+
+bool ConstraintModel::isMpc() {
+    QMutexLocker locker(&this->model_lock_);
+    return this->is_mpc_;
+}
+
+void ConstraintModel::setMpcMode(bool mpc_mode) {
+    QMutexLocker locker(&this->model_lock_);
+    this->is_mpc_ = mpc_mode;
+    this->bumpModelVersion();
+}
+
+bool ConstraintModel::isSolvePaused(DroneModelItem *drone) {
+    QMutexLocker locker(&this->model_lock_);
+    // in mpc mode only the executing drone keeps solving
+    return this->is_live_reference_ &&
+            !(this->is_mpc_ && drone == this->staged_drone_);
 }
 
 bool ConstraintModel::isFreeFinalTime() {
@@ -371,6 +438,7 @@ bool ConstraintModel::isFreeFinalTime() {
 void ConstraintModel::setFreeFinalTime(bool free_final_time) {
     QMutexLocker locker(&this->model_lock_);
     this->is_free_final_time_ = free_final_time;
+    this->bumpModelVersion();
 }
 
 void ConstraintModel::setCurrDrone(DroneModelItem *drone) {
@@ -434,6 +502,9 @@ void ConstraintModel::setSkyeFlyParams(QTableWidget *params_table) {
             (params_table->cellWidget(row_index++, 0))->value();
     this->P_.min_time_weight = qobject_cast<QDoubleSpinBox *>
             (params_table->cellWidget(row_index++, 0))->value();
+
+    // wake compute threads to use new params
+    this->bumpModelVersion();
 }
 
 skyenet::params ConstraintModel::getSkyeFlyParams() {
@@ -589,15 +660,6 @@ bool ConstraintModel::setIsValidInput(INPUT_CODE code) {
     return new_code;
 }
 
-QVector<QRegion> ConstraintModel::getEllipseRegions() {
-    QMutexLocker locker(&this->model_lock_);
-    QVector<QRegion> regions;
-    for (EllipseModelItem *ellipse : this->ellipses_) {
-        regions.append(ellipse->getRegion());
-    }
-    return regions;
-}
-
 void ConstraintModel::updateEllipseColors() {
     QMutexLocker locker(&this->model_lock_);
 
@@ -639,11 +701,105 @@ void ConstraintModel::updateCylinderColors() {
     }
 }
 
+void ConstraintModel::notifyChange() {
+    // safe to call while holding model_lock_, waiting threads
+    // only ever hold change_lock_
+    QMutexLocker locker(&this->change_lock_);
+    this->change_count_++;
+    this->change_cond_.wakeAll();
+}
+
+quint64 ConstraintModel::getChangeCount() {
+    QMutexLocker locker(&this->change_lock_);
+    return this->change_count_;
+}
+
+quint64 ConstraintModel::getModelVersion() {
+    return this->published_version_.load();
+}
+
+void ConstraintModel::dataModelChanged(bool is_constraint) {
+    // called with item lock held, do not take model_lock_.
+    // Constraint changes wake compute threads once published
+    if (is_constraint) {
+        this->model_version_++;
+    } else {
+        this->notifyChange();
+    }
+}
+
+std::shared_ptr<ConstraintSnapshot const> ConstraintModel::getSnapshot() {
+    return std::atomic_load(&this->snapshot_);
+}
+
+void ConstraintModel::publishSnapshot() {
+    // drags change items many times between flushes, build once
+    quint64 version = this->model_version_.load();
+    std::shared_ptr<ConstraintSnapshot const> snapshot =
+            std::atomic_load(&this->snapshot_);
+    if (snapshot && snapshot->version == version) {
+        return;
+    }
+
+    QMutexLocker locker(&this->model_lock_);
+    // read version before items so an edit during the build
+    // is published on the next flush
+    version = this->model_version_.load();
+
+    std::shared_ptr<ConstraintSnapshot> fresh =
+            std::make_shared<ConstraintSnapshot>();
+    fresh->version = version;
+    fresh->P = this->P_;
+    std::fill(&fresh->wp[0][0], &fresh->wp[0][0] +
+              (skyenet::MAX_WAYPOINTS * 3), 0.0);
+    fresh->is_free_final_time = this->is_free_final_time_;
+
+    this->loadEllipseConstraints(&fresh->P);
+    this->loadCylinderConstraints(&fresh->P);
+    this->loadPosConstraints(&fresh->P);
+    this->loadWaypointConstraints(&fresh->P, fresh->wp);
+    fresh->waypoint_key = this->waypoints_.size();
+    for (PointModelItem *waypoint : this->waypoints_) {
+        fresh->waypoint_key = (fresh->waypoint_key * 31) +
+                reinterpret_cast<quintptr>(waypoint);
+    }
+
+    // only moved obstacles are rebinned, overlap is
+    // cached until an obstacle changes
+    this->updateObstacleIndex();
+    fresh->is_obs_overlap = this->obstacle_index_.hasOverlap();
+
+    snapshot = fresh;
+    std::atomic_store(&this->snapshot_, snapshot);
+    this->published_version_.storeRelease(version);
+    locker.unlock();
+
+    // wake compute threads to solve with new snapshot
+    this->notifyChange();
+}
+
+bool ConstraintModel::waitForChange(quint64 seen,
+                                    unsigned long timeout_ms) {
+    QMutexLocker locker(&this->change_lock_);
+    // only sleep if nothing changed since caller last looked,
+    // otherwise a wakeup between check and wait would be lost
+    if (this->change_count_ == seen) {
+        this->change_cond_.wait(&this->change_lock_, timeout_ms);
+    }
+    return this->change_count_ != seen;
+}
+
+// ====== Private functions, do not lock ======
+
+void ConstraintModel::bumpModelVersion() {
+    // mark snapshot out of date, trajectories are out of date
+    // once it is published
+    this->model_version_++;
+}
+
 void ConstraintModel::loadWaypointConstraints(
             skyenet::params *P,
             double wp[skyenet::MAX_WAYPOINTS][3]) {
-    QMutexLocker locker(&this->model_lock_);
-
     P->n_wp = this->waypoints_.size();
     // no waypoints, dont factor in relaxation
     if (P->n_wp == 0) {
@@ -664,45 +820,20 @@ void ConstraintModel::loadWaypointConstraints(
 }
 
 void ConstraintModel::loadEllipseConstraints(skyenet::params *P) {
-    QMutexLocker locker(&this->model_lock_);
-
-    quint32 index = 0;
-    for (EllipseModelItem *ellipse : this->ellipses_) {
-        // calculate ellipse matrix in meters
-
-        P->obs.R[index] = 1;
-        qreal a = (ellipse->getHeight() / GRID_SIZE) + this->clearance_;
-        qreal inv_a = 1.0 / a;
-        qreal b = (ellipse->getWidth() / GRID_SIZE) + this->clearance_;
-        qreal inv_b = 1.0 / b;
-        qreal t = ellipse->getRot();
-        qreal sin_t = qSin(qDegreesToRadians(t));
-        qreal cos_t = qCos(qDegreesToRadians(t));
-        qreal cos_t_2 = qPow(cos_t, 2);
-        qreal sin_t_2 = qPow(sin_t, 2);
-
-        P->obs.M0[0][index] = (inv_a * cos_t_2) + (inv_b * sin_t_2);
-        P->obs.M0[1][index] = (inv_a * sin_t * cos_t) - (inv_b * sin_t * cos_t);
-        P->obs.M1[0][index] = (inv_a * sin_t * cos_t) - (inv_b * sin_t * cos_t);
-        P->obs.M1[1][index] = (inv_a * sin_t_2) + (inv_b * cos_t_2);
-
-        QPointF ellipse_pos = ellipse->getPos();
-        QVector3D xyz_coords = guiXyzToXyz(ellipse_pos.x(), ellipse_pos.y(), 0);
-        P->obs.c_x[index] = xyz_coords.x();
-        P->obs.c_y[index] = xyz_coords.y();
-        index++;
-        // dont go over max
-        if (index >= skyenet::MAX_OBS) {
-            P->obs.n = index;
-            return;
+    // refresh rows for ellipses changed since last load,
+    // matrices are precomputed by the items
+    for (int i = 0; i < this->ellipses_.size(); i++) {
+        EllipseModelItem *ellipse = this->ellipses_.at(i);
+        quint64 generation = ellipse->getGeneration();
+        if (generation != this->ellipse_store_.getGeneration(i)) {
+            this->ellipse_store_.set(i, ellipse->getShape(), generation);
         }
     }
-    P->obs.n = index;
+
+    this->ellipse_store_.fill(P);
 }
 
 void ConstraintModel::loadCylinderConstraints(skyenet::params *P) {
-    QMutexLocker locker(&this->model_lock_);
-
     quint32 index = 0;
     for (CylinderModelItem *cylinder : this->cylinders_) {
         // calculate cylinder properties
@@ -732,8 +863,6 @@ void ConstraintModel::loadCylinderConstraints(skyenet::params *P) {
 }
 
 void ConstraintModel::loadPosConstraints(skyenet::params *P) {
-    QMutexLocker locker(&this->model_lock_);
-
     quint32 index = 0;
     for (PolygonModelItem *polygon : this->polygons_) {
         quint32 size = polygon->getSize();
@@ -778,7 +907,14 @@ void ConstraintModel::loadPosConstraints(skyenet::params *P) {
     P->cpos.n = index;
 }
 
-// ====== Private functions, do not lock ======
+void ConstraintModel::updateObstacleIndex() {
+    for (EllipseModelItem *ellipse : this->ellipses_) {
+        this->obstacle_index_.updateEllipse(ellipse);
+    }
+    for (CylinderModelItem *cylinder : this->cylinders_) {
+        this->obstacle_index_.updateCylinder(cylinder);
+    }
+}
 
 void ConstraintModel::loadPlaneConstraint(skyenet::params *P, quint32 index,
                                           QVector3D xyz_p, QVector3D xyz_q) {
@@ -0,0 +1,413 @@
+// TITLE:   Optimization_Interface/src/models/obstacle_index.cpp
+// AUTHORS: Daniel Sullivan
+// LAB:     Autonomous Controls Lab (ACL)
+// LICENSE: Copyright 2020, All Rights Reserved
+
+#include "include/models/obstacle_index.h"
+
+#include <QtMath>
+
+#include <algorithm>
+#include <cmath>
+
+namespace optgui {
+
+ObstacleIndex::ObstacleIndex() {
+    this->is_dirty_ = false;
+    this->is_overlap_ = false;
+}
+
+void ObstacleIndex::addEllipse(EllipseModelItem *item) {
+    this->addEntry(item, ELLIPSE_ENTRY);
+}
+
+void ObstacleIndex::addCylinder(CylinderModelItem *item) {
+    this->addEntry(item, CYLINDER_ENTRY);
+}
+
+void ObstacleIndex::remove(DataModel *item) {
+    if (!this->slots_.contains(item)) {
+        return;
+    }
+    int slot = this->slots_.take(item);
+    this->unbin(slot);
+    this->free_slots_.append(slot);
+    this->is_dirty_ = true;
+}
+
+void ObstacleIndex::updateEllipse(EllipseModelItem *item) {
+    int slot = this->slots_.value(item, -1);
+    if (slot < 0) {
+        return;
+    }
+    // skip if unchanged
+    quint64 generation = item->getGeneration();
+    Entry &entry = this->entries_[slot];
+    if (entry.generation == generation) {
+        return;
+    }
+
+    EllipseShape shape = item->getShape();
+    entry.generation = generation;
+    entry.c_x = shape.c_x;
+    entry.c_y = shape.c_y;
+    entry.m00 = shape.m00;
+    entry.m01 = shape.m01;
+    entry.m10 = shape.m10;
+    entry.m11 = shape.m11;
+
+    // bounds of rotated ellipse
+    double cos_t = qCos(shape.rot);
+    double sin_t = qSin(shape.rot);
+    double half_x = qSqrt(qPow(shape.a * cos_t, 2) +
+                          qPow(shape.b * sin_t, 2));
+    double half_y = qSqrt(qPow(shape.a * sin_t, 2) +
+                          qPow(shape.b * cos_t, 2));
+    entry.min_x = shape.c_x - half_x;
+    entry.max_x = shape.c_x + half_x;
+    entry.min_y = shape.c_y - half_y;
+    entry.max_y = shape.c_y + half_y;
+
+    this->unbin(slot);
+    this->bin(slot);
+    this->is_dirty_ = true;
+}
+
+void ObstacleIndex::updateCylinder(CylinderModelItem *item) {
+    int slot = this->slots_.value(item, -1);
+    if (slot < 0) {
+        return;
+    }
+    // skip if unchanged
+    quint64 generation = item->getGeneration();
+    Entry &entry = this->entries_[slot];
+    if (entry.generation == generation) {
+        return;
+    }
+    entry.generation = generation;
+
+    // height is along x and width along y in meters,
+    // same as loaded into solver
+    QPointF pos = item->getPos();
+    QVector3D xyz_coords = guiXyzToXyz(pos.x(), pos.y(), 0);
+    double half_l = item->getHeight() / GRID_SIZE;
+    double half_w = item->getWidth() / GRID_SIZE;
+    double rot = qDegreesToRadians(item->getRot());
+    double cos_t = qCos(rot);
+    double sin_t = qSin(rot);
+
+    entry.c_x = xyz_coords.x();
+    entry.c_y = xyz_coords.y();
+
+    // corners in counter clockwise order
+    double const signs[4][2] = {{1, 1}, {-1, 1}, {-1, -1}, {1, -1}};
+    entry.min_x = entry.max_x = entry.c_x;
+    entry.min_y = entry.max_y = entry.c_y;
+    for (int i = 0; i < 4; i++) {
+        double local_x = signs[i][0] * half_l;
+        double local_y = signs[i][1] * half_w;
+        double x = entry.c_x + (cos_t * local_x) - (sin_t * local_y);
+        double y = entry.c_y + (sin_t * local_x) + (cos_t * local_y);
+        entry.corners[i][0] = x;
+        entry.corners[i][1] = y;
+        entry.min_x = std::min(entry.min_x, x);
+        entry.max_x = std::max(entry.max_x, x);
+        entry.min_y = std::min(entry.min_y, y);
+        entry.max_y = std::max(entry.max_y, y);
+    }
+
+    this->unbin(slot);
+    this->bin(slot);
+    this->is_dirty_ = true;
+}
+
+bool ObstacleIndex::hasOverlap() {
+    if (!this->is_dirty_) {
+        return this->is_overlap_;
+    }
+    this->is_dirty_ = false;
+    this->is_overlap_ = false;
+
+    for (auto it = this->cells_.constBegin();
+         it != this->cells_.constEnd(); ++it) {
+        QVector<int> const &cell = it.value();
+        if (cell.size() < 2) {
+            continue;
+        }
+        int cell_x = static_cast<qint32>(it.key() >> 32);
+        int cell_y = static_cast<qint32>(it.key() & 0xFFFFFFFF);
+
+        for (int i = 0; i < cell.size(); i++) {
+            Entry const &a = this->entries_.at(cell.at(i));
+            for (int j = i + 1; j < cell.size(); j++) {
+                Entry const &b = this->entries_.at(cell.at(j));
+
+                // check cheaply with bounds first
+                if (a.max_x < b.min_x || b.max_x < a.min_x ||
+                        a.max_y < b.min_y || b.max_y < a.min_y) {
+                    continue;
+                }
+
+                // pair shares every cell its bounds intersection covers,
+                // only test it in the cell with the lowest corner
+                double lo_x = std::max(a.min_x, b.min_x);
+                double lo_y = std::max(a.min_y, b.min_y);
+                if (qFloor(lo_x / CELL_SIZE) != cell_x ||
+                        qFloor(lo_y / CELL_SIZE) != cell_y) {
+                    continue;
+                }
+
+                if (this->isOverlap(a, b)) {
+                    this->is_overlap_ = true;
+                    return true;
+                }
+            }
+        }
+    }
+    return false;
+}
+
+bool ObstacleIndex::hasOverlapAllPairs() {
+    QVector<int> used_slots = this->slots_.values().toVector();
+    for (int i = 0; i < used_slots.size(); i++) {
+        Entry const &a = this->entries_.at(used_slots.at(i));
+        for (int j = i + 1; j < used_slots.size(); j++) {
+            Entry const &b = this->entries_.at(used_slots.at(j));
+            if (a.max_x < b.min_x || b.max_x < a.min_x ||
+                    a.max_y < b.min_y || b.max_y < a.min_y) {
+                continue;
+            }
+            if (this->isOverlap(a, b)) {
+                return true;
+            }
+        }
+    }
+    return false;
+}
+
+// ====== Private functions ======
+
+int ObstacleIndex::addEntry(DataModel *item, ENTRY_TYPE type) {
+    int slot;
+    if (this->free_slots_.isEmpty()) {
+        slot = this->entries_.size();
+        this->entries_.append(Entry());
+    } else {
+        slot = this->free_slots_.takeLast();
+    }
+
+    Entry &entry = this->entries_[slot];
+    entry.type = type;
+    entry.generation = INVALID_GENERATION;
+    entry.is_binned = false;
+    this->slots_.insert(item, slot);
+    return slot;
+}
+
+void ObstacleIndex::bin(int slot) {
+    Entry &entry = this->entries_[slot];
+    entry.cell_x0 = qFloor(entry.min_x / CELL_SIZE);
+    entry.cell_y0 = qFloor(entry.min_y / CELL_SIZE);
+    entry.cell_x1 = qFloor(entry.max_x / CELL_SIZE);
+    entry.cell_y1 = qFloor(entry.max_y / CELL_SIZE);
+
+    for (int x = entry.cell_x0; x <= entry.cell_x1; x++) {
+        for (int y = entry.cell_y0; y <= entry.cell_y1; y++) {
+            this->cells_[cellKey(x, y)].append(slot);
+        }
+    }
+    entry.is_binned = true;
+}
+
+void ObstacleIndex::unbin(int slot) {
+    Entry &entry = this->entries_[slot];
+    if (!entry.is_binned) {
+        return;
+    }
+
+    for (int x = entry.cell_x0; x <= entry.cell_x1; x++) {
+        for (int y = entry.cell_y0; y <= entry.cell_y1; y++) {
+            quint64 key = cellKey(x, y);
+            QVector<int> &cell = this->cells_[key];
+            cell.removeOne(slot);
+            if (cell.isEmpty()) {
+                this->cells_.remove(key);
+            }
+        }
+    }
+    entry.is_binned = false;
+}
+
+quint64 ObstacleIndex::cellKey(int x, int y) {
+    return (static_cast<quint64>(static_cast<quint32>(x)) << 32) |
+            static_cast<quint32>(y);
+}
+
+bool ObstacleIndex::isOverlap(Entry const &a, Entry const &b) {
+    if (a.type == ELLIPSE_ENTRY && b.type == ELLIPSE_ENTRY) {
+        return isEllipseEllipseOverlap(a, b);
+    } else if (a.type == ELLIPSE_ENTRY) {
+        return isEllipseBoxOverlap(a, b);
+    } else if (b.type == ELLIPSE_ENTRY) {
+        return isEllipseBoxOverlap(b, a);
+    }
+    // hoops are allowed to overlap each other
+    return false;
+}
+
+bool ObstacleIndex::isEllipseEllipseOverlap(Entry const &a,
+                                            Entry const &b) {
+    // map a to the unit circle with M_a, b becomes an ellipse
+    // with center c' = M_a (c_b - c_a) and matrix N = M_b M_a^-1,
+    // overlap if b' contains origin or is closer than 1 to it
+    double det = (a.m00 * a.m11) - (a.m01 * a.m10);
+    double i00 = a.m11 / det;
+    double i01 = -a.m01 / det;
+    double i10 = -a.m10 / det;
+    double i11 = a.m00 / det;
+
+    double dx = b.c_x - a.c_x;
+    double dy = b.c_y - a.c_y;
+    // origin relative to center of b'
+    double o_x = -((a.m00 * dx) + (a.m01 * dy));
+    double o_y = -((a.m10 * dx) + (a.m11 * dy));
+
+    double n00 = (b.m00 * i00) + (b.m01 * i10);
+    double n01 = (b.m00 * i01) + (b.m01 * i11);
+    double n10 = (b.m10 * i00) + (b.m11 * i10);
+    double n11 = (b.m10 * i01) + (b.m11 * i11);
+
+    // check if origin inside b'
+    double u = (n00 * o_x) + (n01 * o_y);
+    double v = (n10 * o_x) + (n11 * o_y);
+    if ((u * u) + (v * v) < 1.0) {
+        return true;
+    }
+
+    // axes of b' from eigen decomposition of N^T N
+    double p = (n00 * n00) + (n10 * n10);
+    double q = (n00 * n01) + (n10 * n11);
+    double r = (n01 * n01) + (n11 * n11);
+    double mean = (p + r) / 2.0;
+    double diff = qSqrt(qPow((p - r) / 2.0, 2) + (q * q));
+    double lambda_small = mean - diff;
+    double lambda_big = mean + diff;
+
+    // eigenvector of smallest eigenvalue is the major axis
+    double v_x;
+    double v_y;
+    if (qAbs(q) > 1e-12) {
+        v_x = lambda_small - r;
+        v_y = q;
+        double norm = qSqrt((v_x * v_x) + (v_y * v_y));
+        v_x /= norm;
+        v_y /= norm;
+    } else if (p <= r) {
+        v_x = 1;
+        v_y = 0;
+    } else {
+        v_x = 0;
+        v_y = 1;
+    }
+
+    double e0 = 1.0 / qSqrt(lambda_small);
+    double e1 = 1.0 / qSqrt(lambda_big);
+    // origin in b' axis frame, reflected into first quadrant
+    double y0 = qAbs((v_x * o_x) + (v_y * o_y));
+    double y1 = qAbs((-v_y * o_x) + (v_x * o_y));
+
+    return distancePointEllipse(e0, e1, y0, y1) < 1.0;
+}
+
+bool ObstacleIndex::isEllipseBoxOverlap(Entry const &ellipse,
+                                        Entry const &box) {
+    // map ellipse to unit circle, box becomes a parallelogram
+    double corners[4][2];
+    for (int i = 0; i < 4; i++) {
+        double dx = box.corners[i][0] - ellipse.c_x;
+        double dy = box.corners[i][1] - ellipse.c_y;
+        corners[i][0] = (ellipse.m00 * dx) + (ellipse.m01 * dy);
+        corners[i][1] = (ellipse.m10 * dx) + (ellipse.m11 * dy);
+    }
+
+    bool is_inside = true;
+    bool sign = false;
+    for (int i = 0; i < 4; i++) {
+        double const *p = corners[i];
+        double const *q = corners[(i + 1) % 4];
+        double e_x = q[0] - p[0];
+        double e_y = q[1] - p[1];
+
+        // origin inside if on same side of every edge
+        double cross = (e_x * -p[1]) - (e_y * -p[0]);
+        if (i == 0) {
+            sign = cross > 0;
+        } else if (sign != (cross > 0)) {
+            is_inside = false;
+        }
+
+        // closest point on edge to origin
+        double len_2 = (e_x * e_x) + (e_y * e_y);
+        double t = len_2 > 0 ? -((p[0] * e_x) + (p[1] * e_y)) / len_2 : 0;
+        t = std::max(0.0, std::min(1.0, t));
+        double c_x = p[0] + (t * e_x);
+        double c_y = p[1] + (t * e_y);
+        if ((c_x * c_x) + (c_y * c_y) < 1.0) {
+            return true;
+        }
+    }
+    return is_inside;
+}
+
+double ObstacleIndex::distancePointEllipse(double e0, double e1,
+                                           double y0, double y1) {
+    // robust bisection from Eberly, "Distance from a Point to an
+    // Ellipse", point in first quadrant
+    if (y1 > 0) {
+        if (y0 > 0) {
+            double z0 = y0 / e0;
+            double z1 = y1 / e1;
+            double g = (z0 * z0) + (z1 * z1) - 1;
+            if (g == 0) {
+                return 0;
+            }
+            double r0 = (e0 / e1) * (e0 / e1);
+            double n0 = r0 * z0;
+            double s0 = z1 - 1;
+            double s1 = g < 0 ? 0 : std::hypot(n0, z1) - 1;
+            double s = 0;
+            for (int i = 0; i < 149; i++) {
+                s = (s0 + s1) / 2;
+                if (s == s0 || s == s1) {
+                    break;
+                }
+                double ratio0 = n0 / (s + r0);
+                double ratio1 = z1 / (s + 1);
+                g = (ratio0 * ratio0) + (ratio1 * ratio1) - 1;
+                if (g > 0) {
+                    s0 = s;
+                } else if (g < 0) {
+                    s1 = s;
+                } else {
+                    break;
+                }
+            }
+            double x0 = r0 * y0 / (s + r0);
+            double x1 = y1 / (s + 1);
+            return std::hypot(x0 - y0, x1 - y1);
+        }
+        return qAbs(y1 - e1);
+    }
+
+    double numer0 = e0 * y0;
+    double denom0 = (e0 * e0) - (e1 * e1);
+    if (numer0 < denom0) {
+        double xde0 = numer0 / denom0;
+        double x0 = e0 * xde0;
+        double x1 = e1 * qSqrt(1 - (xde0 * xde0));
+        return std::hypot(x0 - y0, x1);
+    }
+    return qAbs(y0 - e0);
+}
+
+}  // namespace optgui
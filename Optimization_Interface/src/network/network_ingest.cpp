@@ -0,0 +1,414 @@
+// TITLE:   Optimization_Interface/src/network/network_ingest.cpp
+// AUTHORS: Daniel Sullivan
+// LAB:     Autonomous Controls Lab (ACL)
+// LICENSE: Copyright 2020, All Rights Reserved
+
+#include "include/network/network_ingest.h"
+
+#include <QTextStream>
+
+#include <sys/socket.h>
+#include <sys/uio.h>
+#include <netinet/in.h>
+#include <poll.h>
+#include <unistd.h>
+#include <cstring>
+
+#include "autogen/lib.h"
+
+#include "include/globals.h"
+
+namespace optgui {
+
+struct NetworkIngest::Batch {
+    char buffers[BATCH_SIZE][BUFFER_SIZE];
+    int lengths[BATCH_SIZE];
+#ifdef __linux__
+    struct iovec iovecs[BATCH_SIZE];
+    struct mmsghdr headers[BATCH_SIZE];
+#endif
+};
+
+NetworkIngest::NetworkIngest(QObject *parent)
+    : QThread(parent), routes_mutex_(), moves_mutex_(), mutex_() {
+    this->batch_ = new Batch();
+#ifdef __linux__
+    // headers point at fixed buffers, only lengths change per call
+    std::memset(this->batch_->headers, 0, sizeof(this->batch_->headers));
+    for (int i = 0; i < BATCH_SIZE; i++) {
+        this->batch_->iovecs[i].iov_base = this->batch_->buffers[i];
+        this->batch_->iovecs[i].iov_len = BUFFER_SIZE;
+        this->batch_->headers[i].msg_hdr.msg_iov = &this->batch_->iovecs[i];
+        this->batch_->headers[i].msg_hdr.msg_iovlen = 1;
+    }
+#endif
+    this->recorder_ = nullptr;
+    this->run_loop_ = false;
+    this->packets_ = 0;
+    this->receive_calls_ = 0;
+    this->bad_packets_ = 0;
+    this->bind_errors_ = 0;
+    this->stats_clock_.start();
+}
+
+NetworkIngest::~NetworkIngest() {
+    this->stopIngest();
+    this->wait();
+    delete this->batch_;
+}
+
+// ============ ROUTES ============
+
+void NetworkIngest::addDrone(DroneGraphicsItem *item) {
+    this->addRoute(DRONE_ROUTE, item->model_->port_, item, item->model_);
+}
+
+void NetworkIngest::addPoint(QGraphicsItem *item, PointModelItem *model) {
+    this->addRoute(POINT_ROUTE, model->port_, item, model);
+}
+
+void NetworkIngest::addEllipse(EllipseGraphicsItem *item) {
+    this->addRoute(ELLIPSE_ROUTE, item->model_->port_, item, item->model_);
+}
+
+void NetworkIngest::addCylinder(CylinderGraphicsItem *item) {
+    this->addRoute(CYLINDER_ROUTE, item->model_->port_, item,
+                   item->model_);
+}
+
+void NetworkIngest::addRoute(ROUTE_TYPE type, quint16 port,
+                             QGraphicsItem *item, DataModel *model) {
+    Route route;
+    route.type = type;
+    route.port = port;
+    route.item = item;
+    route.model = model;
+    this->routes_.append(route);
+}
+
+void NetworkIngest::clearRoutes() {
+    QMutexLocker routes_locker(&this->routes_mutex_);
+    this->routes_.clear();
+    routes_locker.unlock();
+
+    QMutexLocker moves_locker(&this->moves_mutex_);
+    this->moves_.clear();
+}
+
+void NetworkIngest::removeItem(QGraphicsItem *item) {
+    QMutexLocker routes_locker(&this->routes_mutex_);
+    for (Route &route : this->routes_) {
+        if (route.item == item) {
+            route.item = nullptr;
+            route.model = nullptr;
+        }
+    }
+    routes_locker.unlock();
+
+    QMutexLocker moves_locker(&this->moves_mutex_);
+    this->moves_.remove(item);
+}
+
+// ============ SESSIONS ============
+
+void NetworkIngest::setRecorder(SessionRecorder *recorder) {
+    this->recorder_ = recorder;
+}
+
+void NetworkIngest::injectDatagrams(quint16 port,
+                                    QVector<QByteArray> const &datagrams) {
+    this->receive_calls_++;
+    this->packets_ += datagrams.size();
+
+    // coalesce like drainSocket, decode newest valid one only
+    Update update;
+    bool is_updated = false;
+    for (int i = datagrams.size() - 1; i >= 0; i--) {
+        QByteArray const &datagram = datagrams.at(i);
+        // decode clears buffer past datagram, so copy into a full
+        // buffer
+        if (datagram.size() <= BUFFER_SIZE) {
+            std::memcpy(this->inject_buffer_, datagram.constData(),
+                        datagram.size());
+            if (this->decodeDatagram(this->inject_buffer_,
+                                     datagram.size(), &update)) {
+                is_updated = true;
+                break;
+            }
+        }
+        this->bad_packets_++;
+    }
+    if (!is_updated) {
+        return;
+    }
+
+    qint64 time_usec = getMonotonicUsec();
+    QMutexLocker locker(&this->routes_mutex_);
+    for (Route const &route : this->routes_) {
+        if (route.port == port && route.item != nullptr) {
+            this->applyUpdate(route, update, time_usec);
+        }
+    }
+}
+
+// ============ GUI THREAD ============
+
+void NetworkIngest::takeMoves(RepaintCoalescer *coalescer) {
+    QMutexLocker locker(&this->moves_mutex_);
+    for (auto it = this->moves_.constBegin();
+         it != this->moves_.constEnd(); it++) {
+        coalescer->moveItem(it.key(), it.value().pos, it.value().rotation);
+    }
+    this->moves_.clear();
+}
+
+QString NetworkIngest::takeStatsText() {
+    qreal elapsed = this->stats_clock_.restart() / 1000.0;
+    quint64 packets = this->packets_.fetchAndStoreRelaxed(0);
+    quint64 receive_calls = this->receive_calls_.fetchAndStoreRelaxed(0);
+    quint64 bad_packets = this->bad_packets_.fetchAndStoreRelaxed(0);
+    if (elapsed <= 0 || this->routes_.isEmpty()) {
+        return QString();
+    }
+
+    QString text;
+    QTextStream stream(&text);
+    stream.setRealNumberNotation(QTextStream::FixedNotation);
+    stream.setRealNumberPrecision(1);
+    stream << "ingest " << (packets / elapsed) << " pkt/s "
+           << (receive_calls > 0 ? qreal(packets) / receive_calls : 0)
+           << " pkt/recv" << endl;
+    if (bad_packets > 0 || this->bind_errors_.load() > 0) {
+        stream << "ingest errors " << bad_packets << " bad pkts "
+               << this->bind_errors_.load() << " unbound ports" << endl;
+    }
+    return text;
+}
+
+// ============ RECEIVE LOOP ============
+
+void NetworkIngest::startIngest() {
+    // set before start so an immediate stop is not overwritten
+    QMutexLocker locker(&this->mutex_);
+    this->run_loop_ = true;
+    locker.unlock();
+    this->start();
+}
+
+void NetworkIngest::stopIngest() {
+    QMutexLocker locker(&this->mutex_);
+    this->run_loop_ = false;
+}
+
+bool NetworkIngest::getRunFlag() {
+    QMutexLocker locker(&this->mutex_);
+    return this->run_loop_;
+}
+
+void NetworkIngest::run() {
+    this->openSockets();
+    QVector<struct pollfd> fds(this->sockets_.size());
+    for (int i = 0; i < this->sockets_.size(); i++) {
+        fds[i].fd = this->sockets_.at(i);
+        fds[i].events = POLLIN;
+        fds[i].revents = 0;
+    }
+
+    // one wakeup serves every port with data
+    while (this->getRunFlag()) {
+        int ready = poll(fds.data(), fds.size(), POLL_TIMEOUT_MS);
+        if (ready <= 0) {
+            continue;
+        }
+        qint64 time_usec = getMonotonicUsec();
+        for (int i = 0; i < fds.size(); i++) {
+            if (fds.at(i).revents & POLLIN) {
+                this->drainSocket(i, time_usec);
+            }
+        }
+    }
+
+    this->closeSockets();
+}
+
+void NetworkIngest::openSockets() {
+    this->closeSockets();
+    this->bind_errors_ = 0;
+    for (Route const &route : this->routes_) {
+        int fd = socket(AF_INET, SOCK_DGRAM, 0);
+        struct sockaddr_in address;
+        std::memset(&address, 0, sizeof(address));
+        address.sin_family = AF_INET;
+        address.sin_addr.s_addr = htonl(INADDR_ANY);
+        address.sin_port = htons(route.port);
+        if (fd >= 0 && bind(fd, reinterpret_cast<struct sockaddr *>(
+                                &address), sizeof(address)) != 0) {
+            close(fd);
+            fd = -1;
+        }
+        if (fd < 0) {
+            // poll ignores negative fds
+            this->bind_errors_++;
+        }
+        this->sockets_.append(fd);
+    }
+}
+
+void NetworkIngest::closeSockets() {
+    for (int fd : this->sockets_) {
+        if (fd >= 0) {
+            close(fd);
+        }
+    }
+    this->sockets_.clear();
+}
+
+int NetworkIngest::receiveBatch(int socket) {
+    this->receive_calls_++;
+#ifdef __linux__
+    // one syscall for up to BATCH_SIZE datagrams
+    int count = recvmmsg(socket, this->batch_->headers, BATCH_SIZE,
+                         MSG_DONTWAIT, nullptr);
+    for (int i = 0; i < count; i++) {
+        this->batch_->lengths[i] = this->batch_->headers[i].msg_len;
+    }
+#else
+    int count = 0;
+    while (count < BATCH_SIZE) {
+        ssize_t length = recv(socket, this->batch_->buffers[count],
+                              BUFFER_SIZE, MSG_DONTWAIT);
+        if (length < 0) {
+            break;
+        }
+        this->batch_->lengths[count] = length;
+        count++;
+    }
+    if (count == 0) {
+        count = -1;
+    }
+#endif
+    return count;
+}
+
+void NetworkIngest::drainSocket(int index, qint64 time_usec) {
+    int socket = this->sockets_.at(index);
+    Update update;
+    bool is_updated = false;
+
+    for (int batch = 0; batch < MAX_BATCHES; batch++) {
+        int count = this->receiveBatch(socket);
+        if (count <= 0) {
+            break;
+        }
+        this->packets_ += count;
+
+        // record all datagrams so replay sees the same batches
+        if (this->recorder_ != nullptr) {
+            quint16 port = this->routes_.at(index).port;
+            for (int i = 0; i < count; i++) {
+                this->recorder_->recordDatagram(
+                            port, this->batch_->buffers[i],
+                            this->batch_->lengths[i], time_usec);
+            }
+        }
+
+        // older datagrams in batch are superseded, decode newest
+        // valid one only
+        for (int i = count - 1; i >= 0; i--) {
+            if (this->decodeDatagram(this->batch_->buffers[i],
+                                     this->batch_->lengths[i], &update)) {
+                is_updated = true;
+                break;
+            }
+            this->bad_packets_++;
+        }
+
+        if (count < BATCH_SIZE) {
+            // socket is drained
+            break;
+        }
+    }
+
+    if (is_updated) {
+        QMutexLocker locker(&this->routes_mutex_);
+        Route const &route = this->routes_.at(index);
+        if (route.item != nullptr) {
+            this->applyUpdate(route, update, time_usec);
+        }
+    }
+}
+
+bool NetworkIngest::decodeDatagram(char *data, int length,
+                                   Update *update) {
+    if (length <= 0) {
+        return false;
+    }
+    // clear stale bytes so truncated packets fail to deserialize
+    std::memset(data + length, 0, BUFFER_SIZE - length);
+
+    autogen::deserializable::telemetry
+          <autogen::topic::telemetry::UNDEFINED> telemetry_data;
+    // pointer is NULL if does not deserialize correctly
+    const uint8 *ptr_telemetry_data = telemetry_data.deserialize(
+                reinterpret_cast<const uint8 *>(data));
+    if (ptr_telemetry_data == NULL) {
+        return false;
+    }
+
+    update->pos = nedToGuiXyz(telemetry_data.pos_ned(0),
+                              telemetry_data.pos_ned(1),
+                              telemetry_data.pos_ned(2));
+    update->vel = nedToGuiXyz(telemetry_data.vel_ned(0),
+                              telemetry_data.vel_ned(1),
+                              0);  // hard code velocity
+    update->accel = nedToGuiXyz(telemetry_data.accl_b(0),
+                                telemetry_data.accl_b(1),
+                                -9.81);  // hard code gravity
+    gnc::quat rotation = telemetry_data.q_i2b;
+    update->yaw = rotation.yaw_deg();
+    return true;
+}
+
+void NetworkIngest::applyUpdate(Route const &route, Update const &update,
+                                qint64 time_usec) {
+    QPointF pos_2D = QPointF(update.pos.x(), update.pos.y());
+    Move move;
+    move.pos = pos_2D;
+    move.rotation = 0;
+
+    switch (route.type) {
+        case DRONE_ROUTE: {
+            DroneModelItem *model = static_cast<DroneModelItem *>(
+                        route.model);
+            // one sample stamped with arrival time
+            model->setState(update.pos, update.vel, update.accel,
+                            time_usec);
+            break;
+        }
+        case POINT_ROUTE: {
+            static_cast<PointModelItem *>(route.model)->setPos(pos_2D);
+            break;
+        }
+        case ELLIPSE_ROUTE: {
+            EllipseModelItem *model = static_cast<EllipseModelItem *>(
+                        route.model);
+            model->setPos(pos_2D);
+            move.rotation = model->getRot();
+            break;
+        }
+        case CYLINDER_ROUTE: {
+            CylinderModelItem *model = static_cast<CylinderModelItem *>(
+                        route.model);
+            model->setPos(pos_2D);
+            model->setRot(update.yaw);
+            move.rotation = update.yaw;
+            break;
+        }
+    }
+
+    // latest move replaces any not yet taken by GUI thread
+    QMutexLocker locker(&this->moves_mutex_);
+    this->moves_.insert(route.item, move);
+}
+
+}  // namespace optgui
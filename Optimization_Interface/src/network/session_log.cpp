@@ -0,0 +1,98 @@
+// TITLE:   Optimization_Interface/src/network/session_log.cpp
+// AUTHORS: Daniel Sullivan
+// LAB:     Autonomous Controls Lab (ACL)
+// LICENSE: Copyright 2020, All Rights Reserved
+
+#include "include/network/session_log.h"
+
+#include <QtEndian>
+
+#include <cstring>
+
+namespace optgui {
+
+bool SessionLogWriter::writeHeader(QIODevice *device, qint64 start_msec) {
+    QDataStream stream(device);
+    stream.setByteOrder(QDataStream::LittleEndian);
+    stream << MAGIC << VERSION << start_msec;
+    return stream.status() == QDataStream::Ok;
+}
+
+void SessionLogWriter::encodeEditValue(double value, char *data) {
+    quint64 bits = 0;
+    std::memcpy(&bits, &value, sizeof(bits));
+    qToLittleEndian<quint64>(bits, reinterpret_cast<uchar *>(data));
+}
+
+void SessionLogWriter::appendEvent(QByteArray *buffer, qint64 time_usec,
+                                   quint8 type, quint16 code,
+                                   char const *data, int length) {
+    // time, type, code and length
+    uchar header[8 + 1 + 2 + 4];
+    qToLittleEndian<qint64>(time_usec, header);
+    header[8] = type;
+    qToLittleEndian<quint16>(code, header + 9);
+    qToLittleEndian<quint32>(length, header + 11);
+    buffer->append(reinterpret_cast<char *>(header), sizeof(header));
+    buffer->append(data, length);
+}
+
+bool SessionLogReader::open(QIODevice *device) {
+    this->stream_.setDevice(device);
+    this->stream_.setByteOrder(QDataStream::LittleEndian);
+    this->start_msec_ = 0;
+
+    quint32 magic = 0;
+    quint32 version = 0;
+    this->stream_ >> magic >> version >> this->start_msec_;
+    if (this->stream_.status() != QDataStream::Ok ||
+            magic != SessionLogWriter::MAGIC) {
+        this->error_ = "not a session log";
+        return false;
+    }
+    if (version > SessionLogWriter::VERSION) {
+        this->error_ = QString("unsupported version %1").arg(version);
+        return false;
+    }
+    return true;
+}
+
+bool SessionLogReader::readEvent(SessionEvent *event) {
+    if (this->stream_.atEnd()) {
+        return false;
+    }
+    quint32 length = 0;
+    this->stream_ >> event->time_usec >> event->type >> event->code
+                  >> length;
+    // reuses data capacity between events
+    event->data.resize(length);
+    if (this->stream_.status() != QDataStream::Ok ||
+            this->stream_.readRawData(event->data.data(), length) !=
+            static_cast<int>(length)) {
+        // recording was cut off, events before it are kept
+        this->error_ = "truncated event";
+        return false;
+    }
+    return true;
+}
+
+QString SessionLogReader::getError() {
+    return this->error_;
+}
+
+qint64 SessionLogReader::getStartMsec() {
+    return this->start_msec_;
+}
+
+double SessionLogReader::getEditValue(SessionEvent const &event) {
+    if (event.data.size() != SessionLogWriter::EDIT_VALUE_SIZE) {
+        return 0;
+    }
+    quint64 bits = qFromLittleEndian<quint64>(
+                reinterpret_cast<uchar const *>(event.data.constData()));
+    double value = 0;
+    std::memcpy(&value, &bits, sizeof(value));
+    return value;
+}
+
+}  // namespace optgui
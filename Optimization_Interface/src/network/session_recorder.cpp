@@ -0,0 +1,142 @@
+// TITLE:   Optimization_Interface/src/network/session_recorder.cpp
+// AUTHORS: Daniel Sullivan
+// LAB:     Autonomous Controls Lab (ACL)
+// LICENSE: Copyright 2020, All Rights Reserved
+
+#include "include/network/session_recorder.h"
+
+#include <QDateTime>
+
+#include "include/globals.h"
+
+namespace optgui {
+
+SessionRecorder::SessionRecorder()
+    : buffer_mutex_(), mutex_(), stop_() {
+    this->file_ = nullptr;
+    this->start_usec_ = 0;
+    // reserved so clearing keeps capacity
+    this->buffer_.reserve(INITIAL_BUFFER_BYTES);
+    this->writing_.reserve(INITIAL_BUFFER_BYTES);
+    this->is_recording_ = false;
+    this->dropped_ = 0;
+    this->run_loop_ = false;
+}
+
+SessionRecorder::~SessionRecorder() {
+    this->close();
+}
+
+bool SessionRecorder::open(QString const &filename) {
+    this->close();
+
+    this->file_ = new QFile(filename);
+    if (!this->file_->open(QIODevice::WriteOnly) ||
+            !SessionLogWriter::writeHeader(
+                this->file_, QDateTime::currentMSecsSinceEpoch())) {
+        delete this->file_;
+        this->file_ = nullptr;
+        return false;
+    }
+
+    QMutexLocker buffer_locker(&this->buffer_mutex_);
+    this->start_usec_ = getMonotonicUsec();
+    this->buffer_.resize(0);
+    this->dropped_ = 0;
+    buffer_locker.unlock();
+    this->is_recording_ = true;
+
+    QMutexLocker locker(&this->mutex_);
+    this->run_loop_ = true;
+    locker.unlock();
+    this->start();
+    return true;
+}
+
+void SessionRecorder::close() {
+    if (this->file_ == nullptr) {
+        return;
+    }
+    // no more events, writer writes buffer before exiting
+    this->is_recording_ = false;
+
+    QMutexLocker locker(&this->mutex_);
+    this->run_loop_ = false;
+    this->stop_.wakeOne();
+    locker.unlock();
+    this->wait();
+
+    this->file_->close();
+    delete this->file_;
+    this->file_ = nullptr;
+}
+
+bool SessionRecorder::isOpen() {
+    return this->file_ != nullptr;
+}
+
+void SessionRecorder::recordDatagram(quint16 port, char const *data,
+                                     int length, qint64 time_usec) {
+    this->recordEvent(SessionEvent::DATAGRAM_EVENT, port, data, length,
+                      time_usec);
+}
+
+void SessionRecorder::recordEdit(SessionEvent::EDIT_TYPE edit,
+                                 double value) {
+    char data[SessionLogWriter::EDIT_VALUE_SIZE];
+    SessionLogWriter::encodeEditValue(value, data);
+    this->recordEvent(SessionEvent::EDIT_EVENT, edit, data, sizeof(data),
+                      getMonotonicUsec());
+}
+
+void SessionRecorder::recordEvent(quint8 type, quint16 code,
+                                  char const *data, int length,
+                                  qint64 time_usec) {
+    if (!this->is_recording_.load()) {
+        return;
+    }
+    QMutexLocker locker(&this->buffer_mutex_);
+    if (this->buffer_.size() + length > MAX_BUFFER_BYTES) {
+        this->dropped_++;
+        return;
+    }
+    SessionLogWriter::appendEvent(&this->buffer_,
+                                  time_usec - this->start_usec_,
+                                  type, code, data, length);
+}
+
+quint64 SessionRecorder::getDropped() {
+    return this->dropped_.load();
+}
+
+void SessionRecorder::run() {
+    QMutexLocker locker(&this->mutex_);
+    while (this->run_loop_) {
+        locker.unlock();
+        this->writeBuffer();
+        locker.relock();
+        // flag checked under lock so a close is never missed
+        if (this->run_loop_) {
+            this->stop_.wait(&this->mutex_, WRITE_INTERVAL_MS);
+        }
+    }
+    locker.unlock();
+
+    // events recorded before close
+    this->writeBuffer();
+    this->file_->flush();
+}
+
+void SessionRecorder::writeBuffer() {
+    // swap keeps capacity of both buffers, so appends rarely allocate
+    QMutexLocker locker(&this->buffer_mutex_);
+    this->buffer_.swap(this->writing_);
+    locker.unlock();
+
+    if (!this->writing_.isEmpty()) {
+        this->file_->write(this->writing_);
+        this->writing_.resize(0);
+    }
+}
+
+}  // namespace optgui
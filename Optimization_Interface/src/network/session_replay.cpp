@@ -0,0 +1,148 @@
+// TITLE:   Optimization_Interface/src/network/session_replay.cpp
+// AUTHORS: Daniel Sullivan
+// LAB:     Autonomous Controls Lab (ACL)
+// LICENSE: Copyright 2020, All Rights Reserved
+
+#include "include/network/session_replay.h"
+
+#include <QTextStream>
+
+#include "include/globals.h"
+
+namespace optgui {
+
+SessionReplay::SessionReplay(NetworkIngest *ingest) : mutex_() {
+    this->ingest_ = ingest;
+    this->file_ = nullptr;
+    this->is_fast_ = false;
+    this->events_ = 0;
+    this->session_usec_ = 0;
+    this->stats_session_usec_ = 0;
+    this->run_loop_ = false;
+    this->stats_clock_.start();
+}
+
+SessionReplay::~SessionReplay() {
+    this->stopReplay();
+}
+
+bool SessionReplay::startReplay(QString const &filename, bool is_fast) {
+    this->stopReplay();
+
+    this->file_ = new QFile(filename);
+    if (!this->file_->open(QIODevice::ReadOnly)) {
+        this->error_ = this->file_->errorString();
+        delete this->file_;
+        this->file_ = nullptr;
+        return false;
+    }
+    if (!this->reader_.open(this->file_)) {
+        this->error_ = this->reader_.getError();
+        delete this->file_;
+        this->file_ = nullptr;
+        return false;
+    }
+
+    this->is_fast_ = is_fast;
+    this->events_ = 0;
+    this->session_usec_ = 0;
+    this->stats_session_usec_ = 0;
+    this->stats_clock_.restart();
+
+    QMutexLocker locker(&this->mutex_);
+    this->run_loop_ = true;
+    locker.unlock();
+    this->start();
+    return true;
+}
+
+void SessionReplay::stopReplay() {
+    QMutexLocker locker(&this->mutex_);
+    this->run_loop_ = false;
+    locker.unlock();
+    this->wait();
+
+    if (this->file_ != nullptr) {
+        this->file_->close();
+        delete this->file_;
+        this->file_ = nullptr;
+    }
+}
+
+QString SessionReplay::getError() {
+    return this->error_;
+}
+
+QString SessionReplay::takeStatsText() {
+    qreal elapsed = this->stats_clock_.restart() / 1000.0;
+    quint64 events = this->events_.fetchAndStoreRelaxed(0);
+    qint64 session_usec = this->session_usec_.load();
+    qint64 played_usec = session_usec - this->stats_session_usec_;
+    this->stats_session_usec_ = session_usec;
+    if (elapsed <= 0 || !this->isRunning()) {
+        return QString();
+    }
+
+    QString text;
+    QTextStream stream(&text);
+    stream.setRealNumberNotation(QTextStream::FixedNotation);
+    stream.setRealNumberPrecision(1);
+    stream << "replay " << (events / elapsed) << " events/s "
+           << (played_usec / (elapsed * 1.0e6)) << "x at "
+           << (session_usec / 1.0e6) << " s" << endl;
+    return text;
+}
+
+bool SessionReplay::getRunFlag() {
+    QMutexLocker locker(&this->mutex_);
+    return this->run_loop_;
+}
+
+void SessionReplay::run() {
+    SessionEvent event;
+    // datagrams of one ingest wakeup, reused between wakeups
+    QVector<QByteArray> datagrams;
+    qint64 start_usec = getMonotonicUsec();
+    bool has_event = this->reader_.readEvent(&event);
+    while (this->getRunFlag() && has_event) {
+        // keep recorded spacing, late events play immediately
+        if (!this->is_fast_) {
+            qint64 remaining = start_usec + event.time_usec -
+                    getMonotonicUsec();
+            while (remaining > 0 && this->getRunFlag()) {
+                QThread::usleep(qMin(remaining, MAX_SLEEP_USEC));
+                remaining = start_usec + event.time_usec -
+                        getMonotonicUsec();
+            }
+        }
+
+        if (event.type == SessionEvent::DATAGRAM_EVENT) {
+            // datagrams drained in one wakeup share port and time,
+            // apply only newest valid one like the ingest thread
+            quint16 port = event.code;
+            qint64 time_usec = event.time_usec;
+            datagrams.resize(0);
+            datagrams.append(event.data);
+            while ((has_event = this->reader_.readEvent(&event))
+                   && event.type == SessionEvent::DATAGRAM_EVENT
+                   && event.code == port
+                   && event.time_usec == time_usec) {
+                datagrams.append(event.data);
+            }
+            this->ingest_->injectDatagrams(port, datagrams);
+            this->events_ += datagrams.size();
+            this->session_usec_ = time_usec;
+            continue;
+        }
+
+        if (event.type == SessionEvent::EDIT_EVENT) {
+            emit this->edit(event.code,
+                            SessionLogReader::getEditValue(event));
+        }
+        this->events_++;
+        this->session_usec_ = event.time_usec;
+        has_event = this->reader_.readEvent(&event);
+    }
+}
+
+}  // namespace optgui
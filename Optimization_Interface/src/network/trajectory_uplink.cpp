@@ -0,0 +1,134 @@
+// TITLE:   Optimization_Interface/src/network/trajectory_uplink.cpp
+// AUTHORS: Daniel Sullivan, Miki Szmuk
+// LAB:     Autonomous Controls Lab (ACL)
+// LICENSE: Copyright 2020, All Rights Reserved
+
+#include "include/network/trajectory_uplink.h"
+
+#include <QElapsedTimer>
+#include <QTextStream>
+#include <QStringList>
+
+namespace optgui {
+
+TrajectoryUplink::TrajectoryUplink() : socket_() {
+}
+
+TrajectoryUplink::~TrajectoryUplink() {
+    // close UDP socket
+    this->socket_.close();
+}
+
+void TrajectoryUplink::addDrone(DroneModelItem *drone) {
+    Destination destination;
+    destination.is_valid = isDestinationAddrValid(drone->ip_addr_,
+                                                  drone->destination_port_);
+    if (destination.is_valid) {
+        destination.address = QHostAddress(drone->ip_addr_);
+    }
+    destination.port = drone->destination_port_;
+    destination.sent = 0;
+    destination.dropped = 0;
+    destination.total_usec = 0;
+    destination.max_usec = 0;
+    this->destinations_.insert(drone, destination);
+}
+
+void TrajectoryUplink::removeDrone(DroneModelItem *drone) {
+    this->destinations_.remove(drone);
+}
+
+void TrajectoryUplink::clearDrones() {
+    this->destinations_.clear();
+}
+
+bool TrajectoryUplink::send(DroneModelItem *drone,
+                            autogen::packet::traj2dof const &traj) {
+    QHash<DroneModelItem *, Destination>::iterator iter =
+            this->destinations_.find(drone);
+    if (iter == this->destinations_.end()) {
+        // drone has no port
+        return false;
+    }
+    Destination &destination = *iter;
+    if (!destination.is_valid) {
+        destination.dropped++;
+        return false;
+    }
+
+    QElapsedTimer timer;
+    timer.start();
+    this->packet_ = traj;
+    if (this->packet_.size() > BUFFER_SIZE) {
+        destination.dropped++;
+        return false;
+    }
+    this->packet_.serialize(reinterpret_cast<uint8 *>(this->buffer_));
+    qint64 bytes_sent = this->socket_.writeDatagram(
+                this->buffer_, this->packet_.size(),
+                destination.address, destination.port);
+    qint64 elapsed = timer.nsecsElapsed() / 1000;
+
+    if (bytes_sent < 0) {
+        destination.dropped++;
+        return false;
+    }
+    destination.sent++;
+    destination.total_usec += elapsed;
+    destination.max_usec = qMax(destination.max_usec, elapsed);
+    return true;
+}
+
+QString TrajectoryUplink::takeStatsText() {
+    QString text;
+    QTextStream stream(&text);
+    stream.setRealNumberNotation(QTextStream::FixedNotation);
+    stream.setRealNumberPrecision(1);
+    for (auto iter = this->destinations_.begin();
+         iter != this->destinations_.end(); iter++) {
+        Destination &destination = *iter;
+        if (destination.sent == 0 && destination.dropped == 0) {
+            continue;
+        }
+        stream << "uplink " << iter.key()->ip_addr_ << ": "
+               << destination.sent << " sent "
+               << destination.dropped << " dropped";
+        if (destination.sent > 0) {
+            stream << " " << (qreal(destination.total_usec) /
+                              destination.sent)
+                   << " us avg " << destination.max_usec << " us max";
+        }
+        stream << endl;
+        destination.sent = 0;
+        destination.dropped = 0;
+        destination.total_usec = 0;
+        destination.max_usec = 0;
+    }
+    return text;
+}
+
+bool TrajectoryUplink::isDestinationAddrValid(QString const &ip_addr,
+                                              quint16 port) {
+    // validate ip address is long enough
+    QStringList ip_addr_sections_ = ip_addr.split(".");
+    if (ip_addr_sections_.size() != 4) {
+        return false;
+    }
+
+    // validate all sections of ipv4 address are valid
+    for (QString addr_section_ : ip_addr_sections_) {
+        bool ok = false;
+        quint16 value = addr_section_.toUShort(&ok);
+        if (!ok || value > 255) {
+            return false;
+        }
+    }
+
+    // validate destination port is valid
+    if (1024 > port) {
+        return false;
+    }
+    return true;
+}
+
+}  // namespace optgui
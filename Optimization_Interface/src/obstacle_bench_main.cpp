@@ -0,0 +1,109 @@
+// TITLE:   Optimization_Interface/src/obstacle_bench_main.cpp
+// AUTHORS: Daniel Sullivan
+// LAB:     Autonomous Controls Lab (ACL)
+// LICENSE: Copyright 2020, All Rights Reserved
+
+// Times obstacle overlap detection with the grid and with all pairs
+
+#include <QCoreApplication>
+#include <QCommandLineParser>
+#include <QElapsedTimer>
+#include <QTextStream>
+#include <QVector>
+#include <QtMath>
+
+#include "include/globals.h"
+#include "include/models/ellipse_model_item.h"
+#include "include/models/cylinder_model_item.h"
+#include "include/models/obstacle_index.h"
+
+using optgui::CylinderModelItem;
+using optgui::EllipseModelItem;
+using optgui::ObstacleIndex;
+
+int main(int argc, char *argv[]) {
+    QCoreApplication app(argc, argv);
+    QCoreApplication::setApplicationName("optgui_obstacle_bench");
+
+    QCommandLineParser parser;
+    parser.setApplicationDescription(
+                "Time overlap checks after moving one obstacle");
+    parser.addHelpOption();
+    QCommandLineOption count_option(
+                QStringList() << "n" << "obstacles",
+                "Obstacles, one in five a cylinder, default 500.",
+                "n", "500");
+    QCommandLineOption iterations_option(
+                QStringList() << "i" << "iterations",
+                "Moves timed, default 1000.", "n", "1000");
+    parser.addOption(count_option);
+    parser.addOption(iterations_option);
+    parser.process(app);
+
+    int count = qMax(2, parser.value(count_option).toInt());
+    int iterations = qMax(1, parser.value(iterations_option).toInt());
+
+    // square layout 3 m apart, 1 m radius ellipses do not overlap so
+    // neither check can return early
+    int columns = qCeil(qSqrt(count));
+    qreal spacing = 3 * optgui::GRID_SIZE;
+    QVector<EllipseModelItem *> ellipses;
+    QVector<CylinderModelItem *> cylinders;
+    ObstacleIndex index;
+    for (int i = 0; i < count; i++) {
+        QPointF pos((i % columns) * spacing, (i / columns) * spacing);
+        if (i % 5 == 4) {
+            CylinderModelItem *cylinder = new CylinderModelItem(pos, 0);
+            cylinders.append(cylinder);
+            index.addCylinder(cylinder);
+            index.updateCylinder(cylinder);
+        } else {
+            EllipseModelItem *ellipse = new EllipseModelItem(pos, 0);
+            ellipses.append(ellipse);
+            index.addEllipse(ellipse);
+            index.updateEllipse(ellipse);
+        }
+    }
+
+    // move one ellipse back and forth, as a drag or telemetry would
+    EllipseModelItem *moved = ellipses.first();
+    QPointF origin = moved->getPos();
+    qint64 grid_nsec = 0;
+    qint64 pairs_nsec = 0;
+    int mismatches = 0;
+    QElapsedTimer timer;
+    for (int i = 0; i < iterations; i++) {
+        moved->setPos(origin + QPointF(i % 2 ? 10 : 0, 0));
+
+        timer.start();
+        index.updateEllipse(moved);
+        bool grid_overlap = index.hasOverlap();
+        grid_nsec += timer.nsecsElapsed();
+
+        timer.start();
+        bool pairs_overlap = index.hasOverlapAllPairs();
+        pairs_nsec += timer.nsecsElapsed();
+
+        if (grid_overlap != pairs_overlap) {
+            mismatches++;
+        }
+    }
+
+    QTextStream out(stdout);
+    out.setRealNumberNotation(QTextStream::FixedNotation);
+    out.setRealNumberPrecision(2);
+    out << count << " obstacles, " << iterations << " moves" << endl;
+    out << "grid      " << (grid_nsec / 1000.0 / iterations)
+        << " us per check" << endl;
+    out << "all pairs " << (pairs_nsec / 1000.0 / iterations)
+        << " us per check" << endl;
+    out << "speedup   " << (qreal(pairs_nsec) / qMax(grid_nsec, 1LL))
+        << "x" << endl;
+    if (mismatches > 0) {
+        out << mismatches << " results differ" << endl;
+    }
+
+    qDeleteAll(ellipses);
+    qDeleteAll(cylinders);
+    return mismatches > 0 ? 1 : 0;
+}
@@ -0,0 +1,94 @@
+// TITLE:   Optimization_Interface/src/paint_bench_main.cpp
+// AUTHORS: Daniel Sullivan
+// LAB:     Autonomous Controls Lab (ACL)
+// LICENSE: Copyright 2020, All Rights Reserved
+
+// Times painting a trajectory graphic into an offscreen image
+
+#include <QGuiApplication>
+#include <QCommandLineParser>
+#include <QElapsedTimer>
+#include <QImage>
+#include <QPainter>
+#include <QTextStream>
+#include <QtMath>
+
+#include "algorithm.h"
+
+#include "include/globals.h"
+#include "include/models/path_model_item.h"
+#include "include/graphics/path_graphics_item.h"
+
+using optgui::PathGraphicsItem;
+using optgui::PathModelItem;
+using optgui::TrajectoryFrame;
+
+int main(int argc, char *argv[]) {
+    // paint without a display unless a platform is given
+    if (qEnvironmentVariableIsEmpty("QT_QPA_PLATFORM")) {
+        qputenv("QT_QPA_PLATFORM", "offscreen");
+    }
+    QGuiApplication app(argc, argv);
+    QGuiApplication::setApplicationName("optgui_paint_bench");
+
+    QCommandLineParser parser;
+    parser.setApplicationDescription(
+                "Time painting one trajectory into an image");
+    parser.addHelpOption();
+    QCommandLineOption points_option(
+                QStringList() << "k" << "points",
+                QString("Trajectory nodes, default solver max horizon %1.")
+                .arg(skyenet::MAX_HORIZON),
+                "n", QString::number(skyenet::MAX_HORIZON));
+    QCommandLineOption iterations_option(
+                QStringList() << "i" << "iterations",
+                "Paints timed, default 1000.", "n", "1000");
+    parser.addOption(points_option);
+    parser.addOption(iterations_option);
+    parser.process(app);
+
+    int points = qMax(2, parser.value(points_option).toInt());
+    int iterations = qMax(1, parser.value(iterations_option).toInt());
+
+    // spiral through a 10 m square so segments turn like a
+    // trajectory around obstacles
+    PathModelItem model;
+    TrajectoryFrame *frame = model.getBackFrame();
+    frame->points.resize(points);
+    qreal radius = 5 * optgui::GRID_SIZE;
+    for (int i = 0; i < points; i++) {
+        qreal t = static_cast<qreal>(i) / (points - 1);
+        qreal angle = 4 * M_PI * t;
+        frame->points[i] = QPointF(radius * (1 + t * qCos(angle)),
+                                   radius * (1 + t * qSin(angle)));
+    }
+    model.publishFrame();
+
+    // item outside a scene paints at unit zoom
+    PathGraphicsItem item(&model);
+    item.setColor(optgui::YELLOW);
+    item.updateGeometry();
+
+    // antialiased like the canvas view
+    QImage image(qCeil(2 * radius) + 1, qCeil(2 * radius) + 1,
+                 QImage::Format_ARGB32_Premultiplied);
+    QPainter painter(&image);
+    painter.setRenderHint(QPainter::Antialiasing);
+
+    qint64 nsec = 0;
+    QElapsedTimer timer;
+    for (int i = 0; i < iterations; i++) {
+        painter.fillRect(image.rect(), Qt::white);
+        timer.start();
+        item.paint(&painter, nullptr);
+        nsec += timer.nsecsElapsed();
+    }
+    painter.end();
+
+    QTextStream out(stdout);
+    out.setRealNumberNotation(QTextStream::FixedNotation);
+    out.setRealNumberPrecision(2);
+    out << points << " points, " << iterations << " paints" << endl;
+    out << "paint " << (nsec / 1000.0 / iterations) << " us" << endl;
+    return 0;
+}
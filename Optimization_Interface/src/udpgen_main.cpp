@@ -0,0 +1,113 @@
+// TITLE:   Optimization_Interface/src/udpgen_main.cpp
+// AUTHORS: Daniel Sullivan
+// LAB:     Autonomous Controls Lab (ACL)
+// LICENSE: Copyright 2020, All Rights Reserved
+
+// Sends telemetry for vehicles circling at a fixed total packet rate
+
+#include <QCoreApplication>
+#include <QCommandLineParser>
+#include <QUdpSocket>
+#include <QHostAddress>
+#include <QElapsedTimer>
+#include <QThread>
+#include <QTextStream>
+#include <QVector>
+#include <QtMath>
+
+#include "autogen/lib.h"
+
+int main(int argc, char *argv[]) {
+    QCoreApplication app(argc, argv);
+    QCoreApplication::setApplicationName("optgui_udpgen");
+
+    QCommandLineParser parser;
+    parser.setApplicationDescription(
+                "Send circling vehicle telemetry to GUI item ports");
+    parser.addHelpOption();
+    parser.addPositionalArgument("ports", "Item ports, one vehicle each",
+                                 "<port>...");
+    QCommandLineOption host_option(
+                "host", "Destination address, default 127.0.0.1.",
+                "addr", "127.0.0.1");
+    QCommandLineOption rate_option(
+                QStringList() << "r" << "rate",
+                "Packets per second over all ports, default 10000.",
+                "n", "10000");
+    QCommandLineOption duration_option(
+                QStringList() << "d" << "duration",
+                "Seconds to send, default 10.", "s", "10");
+    QCommandLineOption radius_option(
+                "radius", "Circle radius in meters, default 3.", "m", "3");
+    parser.addOption(host_option);
+    parser.addOption(rate_option);
+    parser.addOption(duration_option);
+    parser.addOption(radius_option);
+    parser.process(app);
+
+    QVector<quint16> ports;
+    for (QString const &arg : parser.positionalArguments()) {
+        quint16 port = arg.toUShort();
+        if (port > 0) {
+            ports.append(port);
+        }
+    }
+    if (ports.isEmpty()) {
+        parser.showHelp(1);
+    }
+
+    QHostAddress host(parser.value(host_option));
+    qreal rate = qMax(1.0, parser.value(rate_option).toDouble());
+    qint64 duration_usec =
+            qRound64(parser.value(duration_option).toDouble() * 1.0e6);
+    qreal radius = parser.value(radius_option).toDouble();
+    // one lap every 10 s
+    qreal omega = 2 * M_PI / 10.0;
+
+    QUdpSocket socket;
+    autogen::packet::telemetry telemetry;
+    autogen::serializable::telemetry
+            <autogen::topic::telemetry::UNDEFINED> ser_data;
+    char buffer[4096] = {0};
+
+    // pace on monotonic clock, catching up after oversleeping
+    QElapsedTimer clock;
+    clock.start();
+    quint64 sent = 0;
+    quint64 failed = 0;
+    qint64 now_usec = 0;
+    while (now_usec < duration_usec) {
+        quint64 due = qFloor(now_usec * rate / 1.0e6);
+        while (sent + failed < due) {
+            // round robin over ports, vehicles spread around circle
+            int vehicle = (sent + failed) % ports.size();
+            qreal t = now_usec / 1.0e6;
+            qreal phase = (omega * t) + (2 * M_PI * vehicle / ports.size());
+            telemetry.pos_ned(0) = radius * qCos(phase);
+            telemetry.pos_ned(1) = radius * qSin(phase);
+            telemetry.pos_ned(2) = 0;
+            telemetry.vel_ned(0) = -radius * omega * qSin(phase);
+            telemetry.vel_ned(1) = radius * omega * qCos(phase);
+            telemetry.vel_ned(2) = 0;
+            telemetry.accl_b(0) = -radius * omega * omega * qCos(phase);
+            telemetry.accl_b(1) = -radius * omega * omega * qSin(phase);
+            telemetry.accl_b(2) = -9.81;
+
+            ser_data = telemetry;
+            ser_data.serialize(reinterpret_cast<uint8 *>(buffer));
+            if (socket.writeDatagram(buffer, ser_data.size(), host,
+                                     ports.at(vehicle)) < 0) {
+                failed++;
+            } else {
+                sent++;
+            }
+        }
+        QThread::usleep(100);
+        now_usec = clock.nsecsElapsed() / 1000;
+    }
+
+    QTextStream out(stdout);
+    out << sent << " packets sent, " << failed << " failed, "
+        << (sent / (now_usec / 1.0e6)) << " pkt/s" << endl;
+    return failed > 0 ? 1 : 0;
+}